@@ -0,0 +1,91 @@
+#include <QApplication>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QStyle>
+#include <QStyleOptionButton>
+
+#include "actionbuttondelegate.h"
+
+namespace {
+
+auto styleOf(const QStyleOptionViewItem &option) -> QStyle*
+{
+    return option.widget? option.widget->style(): QApplication::style();
+}
+
+auto buttonOption(const QStyleOptionViewItem &option,
+                  const QModelIndex &index,
+                  bool pressed) -> QStyleOptionButton
+{
+    auto button = QStyleOptionButton{};
+    button.rect = option.rect;
+    button.palette = option.palette;
+    button.fontMetrics = option.fontMetrics;
+    button.direction = option.direction;
+    button.text = index.data(Qt::DisplayRole).toString();
+    button.state = QStyle::State_None;
+    if (index.flags().testFlag(Qt::ItemIsEnabled)) {
+        button.state |= QStyle::State_Enabled;
+    }
+    button.state |= pressed? QStyle::State_Sunken: QStyle::State_Raised;
+    return button;
+}
+
+}
+
+void ActionButtonDelegate::paint(QPainter *painter,
+                                 const QStyleOptionViewItem &option,
+                                 const QModelIndex &index) const
+{
+    const auto button = buttonOption(option, index, this->pressed == index);
+    styleOf(option)->drawControl(QStyle::CE_PushButton, &button,
+                                 painter, option.widget);
+}
+
+auto ActionButtonDelegate::sizeHint(const QStyleOptionViewItem &option,
+                                    const QModelIndex &index) const
+    -> QSize
+{
+    const auto button = buttonOption(option, index, false);
+    const auto textSize = option.fontMetrics.size(Qt::TextShowMnemonic,
+                                                  button.text);
+    return styleOf(option)->sizeFromContents(QStyle::CT_PushButton, &button,
+                                             textSize, option.widget);
+}
+
+auto ActionButtonDelegate::editorEvent(QEvent *event,
+                                       QAbstractItemModel *model,
+                                       const QStyleOptionViewItem &option,
+                                       const QModelIndex &index) -> bool
+{
+    if (!index.flags().testFlag(Qt::ItemIsEnabled)) {
+        return QStyledItemDelegate::editorEvent(event, model, option, index);
+    }
+    switch (event->type()) {
+    case QEvent::MouseButtonPress:
+    case QEvent::MouseButtonDblClick:
+    {
+        const auto mouseEvent = static_cast<QMouseEvent*>(event);
+        if ((mouseEvent->button() != Qt::LeftButton) ||
+            !option.rect.contains(mouseEvent->position().toPoint())) {
+            break;
+        }
+        this->pressed = index;
+        return true;
+    }
+    case QEvent::MouseButtonRelease:
+    {
+        const auto mouseEvent = static_cast<QMouseEvent*>(event);
+        const auto wasPressed = (this->pressed == index);
+        this->pressed = QPersistentModelIndex{};
+        if (wasPressed && (mouseEvent->button() == Qt::LeftButton) &&
+            option.rect.contains(mouseEvent->position().toPoint())) {
+            emit clicked(index);
+        }
+        return wasPressed;
+    }
+    default:
+        break;
+    }
+    return QStyledItemDelegate::editorEvent(event, model, option, index);
+}
@@ -0,0 +1,41 @@
+#ifndef ACTIONBUTTONDELEGATE_H
+#define ACTIONBUTTONDELEGATE_H
+
+#include <QPersistentModelIndex>
+#include <QStyledItemDelegate>
+
+/// @brief Delegate painting & handling an index as a push button.
+/// @note The button's text is the display role of the index & it's
+///   enabled when the index is. Pressing & releasing the mouse over
+///   it signals <code>clicked</code>. Nothing is allocated per item,
+///   unlike a push button widget in each cell.
+class ActionButtonDelegate : public QStyledItemDelegate
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    using QStyledItemDelegate::QStyledItemDelegate;
+
+    void paint(QPainter *painter,
+               const QStyleOptionViewItem &option,
+               const QModelIndex &index) const override;
+    [[nodiscard]] auto sizeHint(const QStyleOptionViewItem &option,
+                                const QModelIndex &index) const
+        -> QSize override;
+
+signals:
+    void clicked(const QModelIndex& index);
+
+protected:
+    auto editorEvent(QEvent *event,
+                     QAbstractItemModel *model,
+                     const QStyleOptionViewItem &option,
+                     const QModelIndex &index) -> bool override;
+
+private:
+    QPersistentModelIndex pressed;
+};
+
+#endif // ACTIONBUTTONDELEGATE_H
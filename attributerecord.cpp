@@ -0,0 +1,150 @@
+#include <algorithm> // for std::ranges::is_sorted, std::ranges::lower_bound
+#include <array>
+#include <charconv> // for std::from_chars
+
+#include "attributerecord.h"
+#include "backupattributes.h"
+
+namespace {
+
+auto decodeString(QByteArrayView value) -> QString
+{
+    // Trailing null characters are dropped.
+    while (!value.isEmpty() && (value.back() == '\0')) {
+        value.chop(1);
+    }
+    return QString::fromUtf8(value);
+}
+
+auto decodeInteger(QByteArrayView value) -> std::optional<qint64>
+{
+    value = value.trimmed();
+    const auto first = value.data();
+    const auto last = first + value.size();
+    auto result = qint64{};
+    const auto [ptr, ec] = std::from_chars(first, last, result);
+    if ((ec != std::errc{}) || (ptr != last) || value.isEmpty()) {
+        return {};
+    }
+    return result;
+}
+
+auto decodeMicroseconds(QByteArrayView value)
+    -> std::optional<std::chrono::microseconds>
+{
+    if (const auto number = decodeInteger(value)) {
+        return std::chrono::microseconds{*number};
+    }
+    return {};
+}
+
+}
+
+struct AttributeRecordBuilder::Entry
+{
+    std::string_view name;
+    void (*decode)(AttributeRecordBuilder& builder, QByteArrayView value);
+};
+
+auto BackupRecord::sealed() const noexcept -> bool
+{
+    return this->finished && this->state && !this->state->isEmpty();
+}
+
+auto AttributeRecordBuilder::find(std::string_view name) noexcept
+    -> const Entry*
+{
+    using Builder = AttributeRecordBuilder;
+    // Sorted by name for searching.
+    static constexpr auto entries = std::to_array<Entry>({
+        {snapshotNumberAttr, [](Builder& b, QByteArrayView v){
+            b.backup.number = decodeInteger(v);
+        }},
+        {snapshotVersionAttr, [](Builder& b, QByteArrayView v){
+            b.backup.version = decodeInteger(v);
+        }},
+        {machineMacAddrAttr, [](Builder& b, QByteArrayView v){
+            b.isMachineDir = true;
+            b.machine.address = decodeString(v);
+        }},
+        {machineCompNameAttr, [](Builder& b, QByteArrayView v){
+            b.isMachineDir = true;
+            b.machine.computerName = decodeString(v);
+        }},
+        {machineUuidAttr, [](Builder& b, QByteArrayView v){
+            b.isMachineDir = true;
+            b.machine.uuid = decodeString(v);
+        }},
+        {machineModelAttr, [](Builder& b, QByteArrayView v){
+            b.isMachineDir = true;
+            b.machine.model = decodeString(v);
+        }},
+        {snapshotFinishAttr, [](Builder& b, QByteArrayView v){
+            b.backup.finished = decodeMicroseconds(v);
+        }},
+        {snapshotStartAttr, [](Builder& b, QByteArrayView v){
+            b.backup.started = decodeMicroseconds(v);
+        }},
+        {snapshotStateAttr, [](Builder& b, QByteArrayView v){
+            b.backup.state = decodeString(v);
+        }},
+        {totalBytesCopiedAttr, [](Builder& b, QByteArrayView v){
+            b.isBackup = true;
+            b.backup.bytesCopied = decodeInteger(v);
+        }},
+        {snapshotTypeAttr, [](Builder& b, QByteArrayView v){
+            b.isBackup = true;
+            b.backup.type = decodeString(v);
+        }},
+        {volumeUuidAttr, [](Builder& b, QByteArrayView v){
+            b.volume.uuid = decodeString(v);
+        }},
+        {volumeBytesUsedAttr, [](Builder& b, QByteArrayView v){
+            b.isVolume = true;
+            b.volume.bytesUsed = decodeInteger(v);
+        }},
+        {fileSystemTypeAttr, [](Builder& b, QByteArrayView v){
+            b.isVolume = true;
+            b.volume.fileSystemType = decodeString(v);
+        }},
+        {timeMachineMetaAttr, [](Builder& b, QByteArrayView v){
+            b.isStorageDir = v.startsWith("SnapshotStorage");
+        }},
+    });
+    static_assert(std::ranges::is_sorted(entries, {}, &Entry::name));
+    const auto it = std::ranges::lower_bound(entries, name, {}, &Entry::name);
+    return ((it != entries.end()) && (it->name == name))? &(*it): nullptr;
+}
+
+auto AttributeRecordBuilder::decodes(std::string_view name) noexcept -> bool
+{
+    return find(name) != nullptr;
+}
+
+auto AttributeRecordBuilder::decode(std::string_view name,
+                                    QByteArrayView value) -> bool
+{
+    const auto entry = find(name);
+    if (!entry) {
+        return false;
+    }
+    entry->decode(*this, value);
+    return true;
+}
+
+auto AttributeRecordBuilder::record() && -> AttributeRecord
+{
+    if (this->isStorageDir) {
+        return StorageDirRecord{};
+    }
+    if (this->isMachineDir) {
+        return std::move(this->machine);
+    }
+    if (this->isBackup) {
+        return std::move(this->backup);
+    }
+    if (this->isVolume) {
+        return std::move(this->volume);
+    }
+    return {};
+}
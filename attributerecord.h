@@ -0,0 +1,115 @@
+#ifndef ATTRIBUTERECORD_H
+#define ATTRIBUTERECORD_H
+
+#include <chrono>
+#include <optional>
+#include <string_view>
+#include <variant>
+
+#include <QByteArrayView>
+#include <QString>
+
+/// @brief Decoded attributes of a "backup store".
+/// @note This is the "Backups.backupdb" like directory.
+struct StorageDirRecord
+{
+    friend auto operator==(const StorageDirRecord&, const StorageDirRecord&)
+        -> bool = default;
+};
+
+/// @brief Decoded attributes of a "machine directory".
+struct MachineRecord
+{
+    std::optional<QString> computerName;
+    std::optional<QString> uuid;
+    std::optional<QString> model;
+    std::optional<QString> address;
+
+    friend auto operator==(const MachineRecord&, const MachineRecord&)
+        -> bool = default;
+};
+
+/// @brief Decoded attributes of a backup.
+struct BackupRecord
+{
+    std::optional<QString> type;
+    std::optional<QString> state;
+    std::optional<qint64> version;
+    std::optional<qint64> number;
+    std::optional<std::chrono::microseconds> started;
+    /// @note This appears to be removed from backup directories by
+    ///   "tmutil delete -p <dir>".
+    std::optional<std::chrono::microseconds> finished;
+    std::optional<qint64> bytesCopied;
+
+    /// @brief Whether this is a completed backup.
+    /// @note A completed backup has its completion date & its final
+    ///   state set. Its directory never changes after that except by
+    ///   deletion, so it needn't be read again.
+    [[nodiscard]] auto sealed() const noexcept -> bool;
+
+    friend auto operator==(const BackupRecord&, const BackupRecord&)
+        -> bool = default;
+};
+
+/// @brief Decoded attributes of a volume within a backup.
+struct VolumeRecord
+{
+    std::optional<QString> uuid;
+    std::optional<QString> fileSystemType;
+    std::optional<qint64> bytesUsed;
+
+    friend auto operator==(const VolumeRecord&, const VolumeRecord&)
+        -> bool = default;
+};
+
+/// @brief What a directory entry is according to its attributes, along
+///   with those attributes decoded.
+/// @note No value means the entry's attributes aren't Time Machine's.
+using AttributeRecord = std::variant<
+    std::monostate,
+    StorageDirRecord,
+    MachineRecord,
+    BackupRecord,
+    VolumeRecord
+>;
+
+/// @brief Decodes a directory entry's attributes into its record.
+/// @note Attributes are decoded as they're read, on the reading thread,
+///   by the decoders that a compile-time registry pairs with the
+///   attributes' names. So the raw attribute data is neither kept nor
+///   looked up by name afterwards, & only the typed record is handed
+///   on to whatever observes the read.
+class AttributeRecordBuilder
+{
+public:
+    /// @brief Whether the named attribute is one that's decoded.
+    /// @note Other attributes needn't be read.
+    static auto decodes(std::string_view name) noexcept -> bool;
+
+    /// @brief Decodes the given value of the named attribute.
+    /// @return Whether the attribute is one that's decoded.
+    auto decode(std::string_view name, QByteArrayView value) -> bool;
+
+    /// @brief Gets the record of the attributes decoded.
+    /// @note Like when scanning, an entry that has the attributes of a
+    ///   storage directory is taken to be one, else one that has those
+    ///   of a machine directory is taken to be one, & so on for
+    ///   backups & then volumes.
+    [[nodiscard]] auto record() && -> AttributeRecord;
+
+private:
+    struct Entry;
+
+    static auto find(std::string_view name) noexcept -> const Entry*;
+
+    bool isStorageDir{};
+    bool isMachineDir{};
+    bool isBackup{};
+    bool isVolume{};
+    MachineRecord machine;
+    BackupRecord backup;
+    VolumeRecord volume;
+};
+
+#endif // ATTRIBUTERECORD_H
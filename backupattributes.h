@@ -0,0 +1,34 @@
+#ifndef BACKUPATTRIBUTES_H
+#define BACKUPATTRIBUTES_H
+
+// Names of the extended attributes that Time Machine sets. These are
+// decoded by the registry of AttributeRecordBuilder.
+
+// Content of this attribute seems to be comma separated list, where
+// first element is one of the following:
+//   "SnapshotStorage","MachineStore", "Backup", "VolumeStore"
+constexpr auto timeMachineMetaAttr =
+    "com.apple.timemachine.private.structure.metadata";
+
+// Machine level attributes...
+constexpr auto machineMacAddrAttr   = "com.apple.backupd.BackupMachineAddress";
+constexpr auto machineCompNameAttr  = "com.apple.backupd.ComputerName";
+constexpr auto machineUuidAttr      = "com.apple.backupd.HostUUID";
+constexpr auto machineModelAttr     = "com.apple.backupd.ModelID";
+
+// Backup level attributes...
+constexpr auto snapshotTypeAttr     = "com.apple.backupd.SnapshotType";
+constexpr auto snapshotStartAttr    = "com.apple.backupd.SnapshotStartDate";
+constexpr auto snapshotFinishAttr   = "com.apple.backupd.SnapshotCompletionDate";
+constexpr auto totalBytesCopiedAttr = "com.apple.backupd.SnapshotTotalBytesCopied";
+// version 4 appears to add "com.apple.backupd.fstypename" attr to volumes
+constexpr auto snapshotVersionAttr  = "com.apple.backup.SnapshotVersion";
+constexpr auto snapshotStateAttr    = "com.apple.backupd.SnapshotState";
+constexpr auto snapshotNumberAttr   = "com.apple.backup.SnapshotNumber";
+
+// Volume level attributes...
+constexpr auto fileSystemTypeAttr   = "com.apple.backupd.fstypename";
+constexpr auto volumeBytesUsedAttr  = "com.apple.backupd.VolumeBytesUsed";
+constexpr auto volumeUuidAttr       = "com.apple.backupd.SnapshotVolumeUUID";
+
+#endif // BACKUPATTRIBUTES_H
@@ -0,0 +1,546 @@
+#include <algorithm> // for std::max, std::min, std::nth_element, std::sort, std::unique
+
+#include <QSet>
+
+#include "backupcatalog.h"
+#include "backuptimestamp.h"
+
+auto qHash(const BackupCatalog::BackupKey& key, size_t seed) noexcept
+    -> size_t
+{
+    return qHashMulti(seed, key.destination, key.machine, key.name);
+}
+
+namespace {
+
+template <class T, class Index, class KeyOf>
+void reindex(const std::vector<T>& rows, Index& index, KeyOf keyOf)
+{
+    index.clear();
+    const auto count = static_cast<int>(rows.size());
+    for (auto i = 0; i < count; ++i) {
+        index.insert(keyOf(rows[i]), i);
+    }
+}
+
+auto keyOfDestination(const BackupCatalog::Destination& row)
+{
+    return row.id;
+}
+
+auto keyOfVolume(const BackupCatalog::Volume& row)
+{
+    return std::pair{row.name, row.uuid};
+}
+
+auto keyOfBackup(const BackupCatalog::Backup& row)
+{
+    return row.key;
+}
+
+}
+
+BackupCatalog::BackupCatalog(QObject *parent):
+    QObject{parent}
+{
+}
+
+auto BackupCatalog::names() noexcept -> CatalogNames&
+{
+    return this->catalogNames;
+}
+
+auto BackupCatalog::names() const noexcept -> const CatalogNames&
+{
+    return this->catalogNames;
+}
+
+auto BackupCatalog::destinations() const noexcept
+    -> const std::vector<Destination>&
+{
+    return this->destinationRows;
+}
+
+auto BackupCatalog::machines() const noexcept
+    -> const std::vector<Machine>&
+{
+    return this->machineRows;
+}
+
+auto BackupCatalog::volumes() const noexcept
+    -> const std::vector<Volume>&
+{
+    return this->volumeRows;
+}
+
+auto BackupCatalog::backups() const noexcept
+    -> const std::vector<Backup>&
+{
+    return this->backupRows;
+}
+
+auto BackupCatalog::size(Table table) const noexcept -> int
+{
+    switch (table) {
+    case Table::Destinations:
+        return static_cast<int>(this->destinationRows.size());
+    case Table::Machines:
+        return static_cast<int>(this->machineRows.size());
+    case Table::Volumes:
+        return static_cast<int>(this->volumeRows.size());
+    case Table::Backups:
+        return static_cast<int>(this->backupRows.size());
+    }
+    return 0;
+}
+
+auto BackupCatalog::findDestination(const QString& id) const -> int
+{
+    return this->destinationIndex.value(id, -1);
+}
+
+auto BackupCatalog::findMachine(NameId name,
+                                const QString& uuid) const -> int
+{
+    return this->machineIndex.value({name, uuid}, -1);
+}
+
+auto BackupCatalog::findMachine(NameId name) const -> int
+{
+    return this->machineNameIndex.value(name, -1);
+}
+
+auto BackupCatalog::findVolume(NameId name,
+                               const QString& uuid) const -> int
+{
+    return this->volumeIndex.value({name, uuid}, -1);
+}
+
+auto BackupCatalog::sealedBackups(NameId destination,
+                                  NameId machine) const -> IdSet
+{
+    return this->sealedBackupIds.value({destination, machine});
+}
+
+auto BackupCatalog::findBackup(const BackupKey& key) const -> int
+{
+    return this->backupIndex.value(key, -1);
+}
+
+template <class T, class Index, class KeyOf>
+void BackupCatalog::append(Table table,
+                           std::vector<T>& rows,
+                           Index& index,
+                           std::vector<T>& added,
+                           KeyOf keyOf)
+{
+    if (added.empty()) {
+        return;
+    }
+    const auto first = static_cast<int>(rows.size());
+    const auto last = first + static_cast<int>(added.size()) - 1;
+    emit aboutToInsert(table, first, last);
+    rows.reserve(rows.size() + added.size());
+    for (auto& row: added) {
+        index.insert(keyOf(row), static_cast<int>(rows.size()));
+        rows.push_back(std::move(row));
+    }
+    emit inserted(table, first, last);
+}
+
+template <class T, class Predicate>
+auto BackupCatalog::removeIf(Table table,
+                             std::vector<T>& rows,
+                             Predicate predicate) -> bool
+{
+    auto removedAny = false;
+    // Go backwards so removals don't shift rows yet to be looked at.
+    for (auto last = static_cast<int>(rows.size()) - 1; last >= 0; --last) {
+        if (!predicate(rows[last])) {
+            continue;
+        }
+        auto first = last;
+        while ((first > 0) && predicate(rows[first - 1])) {
+            --first;
+        }
+        emit aboutToRemove(table, first, last);
+        rows.erase(rows.begin() + first, rows.begin() + last + 1);
+        emit removed(table, first, last);
+        removedAny = true;
+        last = first;
+    }
+    return removedAny;
+}
+
+void BackupCatalog::changedRuns(Table table, std::vector<int> indices)
+{
+    std::sort(indices.begin(), indices.end());
+    const auto last = std::unique(indices.begin(), indices.end());
+    for (auto it = indices.begin(); it != last;) {
+        const auto first = *it;
+        auto end = first;
+        while ((++it != last) && (*it == end + 1)) {
+            ++end;
+        }
+        emit changed(table, first, end);
+    }
+}
+
+void BackupCatalog::setDestinations(std::vector<Destination> values)
+{
+    auto ids = QSet<QString>{};
+    for (const auto& value: values) {
+        ids.insert(value.id);
+    }
+    if (this->removeIf(Table::Destinations, this->destinationRows,
+                       [&ids](const Destination& row){
+                           return !ids.contains(row.id);
+                       })) {
+        reindex(this->destinationRows, this->destinationIndex,
+                keyOfDestination);
+    }
+    auto changedRows = std::vector<int>{};
+    auto addedRows = std::vector<Destination>{};
+    for (auto& value: values) {
+        const auto found = this->findDestination(value.id);
+        if (found < 0) {
+            addedRows.push_back(std::move(value));
+            continue;
+        }
+        auto& row = this->destinationRows[found];
+        if (row != value) {
+            row = std::move(value);
+            changedRows.push_back(found);
+        }
+    }
+    this->append(Table::Destinations, this->destinationRows,
+                 this->destinationIndex, addedRows, keyOfDestination);
+    this->changedRuns(Table::Destinations, std::move(changedRows));
+}
+
+auto BackupCatalog::updateMachine(NameId name,
+                                  const QString& uuid,
+                                  const QString& model,
+                                  const QString& address,
+                                  NameId destination) -> int
+{
+    auto found = this->findMachine(name, uuid);
+    if (found < 0) {
+        found = static_cast<int>(this->machineRows.size());
+        emit aboutToInsert(Table::Machines, found, found);
+        this->machineRows.push_back(Machine{.name = name, .uuid = uuid});
+        this->machineIndex.insert({name, uuid}, found);
+        this->machineNameIndex.insert(name, found);
+        emit inserted(Table::Machines, found, found);
+    }
+    auto& row = this->machineRows[found];
+    const auto added = row.destinations.assign(destination, true);
+    if ((row.model != model) || (row.address != address) || added) {
+        row.model = model;
+        row.address = address;
+        emit changed(Table::Machines, found, found);
+    }
+    return found;
+}
+
+void BackupCatalog::insertMachineVolume(NameId machine, NameId volume)
+{
+    const auto found = this->findMachine(machine);
+    if (found < 0) {
+        return;
+    }
+    if (this->machineRows[found].volumes.assign(volume, true)) {
+        emit changed(Table::Machines, found, found);
+    }
+}
+
+auto BackupCatalog::setMachineBackups(NameId destination,
+                                      NameId machine,
+                                      const IdSet& found) -> IdSet
+{
+    const auto isMissing = [&](const BackupKey& key){
+        return (key.machine == machine) &&
+               (key.destination == destination) &&
+               !found.test(key.name);
+    };
+    this->pendingBackups.removeIf([&](QHash<BackupKey, Backup>::iterator it){
+        return isMissing(it.key());
+    });
+    this->pendingBackupVolumes.removeIf([&](QHash<BackupKey, IdSet>::iterator it){
+        return isMissing(it.key());
+    });
+
+    auto removedIds = IdSet{};
+    for (const auto& row: this->backupRows) {
+        if (isMissing(row.key)) {
+            removedIds.set(row.key.name);
+        }
+    }
+    // Evicted backups are only held as sealed.
+    if (const auto it = this->sealedBackupIds.constFind({destination, machine});
+        it != this->sealedBackupIds.constEnd()) {
+        auto missing = *it;
+        missing.subtract(found);
+        (void) removedIds.merge(missing);
+    }
+    // Backups of the machine & volumes aren't by destination, so only
+    // those no longer held for the machine on any destination are gone.
+    auto goneIds = IdSet{};
+    if (!removedIds.empty()) {
+        (void) this->removeIf(Table::Backups, this->backupRows,
+                              [&](const Backup& row){
+                                  return isMissing(row.key);
+                              });
+        reindex(this->backupRows, this->backupIndex, keyOfBackup);
+
+        auto heldIds = IdSet{};
+        for (const auto& row: this->backupRows) {
+            if (row.key.machine == machine) {
+                heldIds.set(row.key.name);
+            }
+        }
+        for (auto it = this->pendingBackups.cbegin(); it != this->pendingBackups.cend(); ++it) {
+            if (it.key().machine == machine) {
+                heldIds.set(it.key().name);
+            }
+        }
+        for (auto it = this->sealedBackupIds.cbegin(); it != this->sealedBackupIds.cend(); ++it) {
+            if ((it.key().second == machine) &&
+                (it.key().first != destination)) {
+                (void) heldIds.merge(it.value());
+            }
+        }
+        goneIds = removedIds;
+        goneIds.subtract(heldIds);
+    }
+    if (!goneIds.empty()) {
+        for (auto& pending: this->pendingVolumes) {
+            if (pending.machines.test(machine)) {
+                pending.backups.subtract(goneIds);
+            }
+        }
+        auto changedRows = std::vector<int>{};
+        const auto count = static_cast<int>(this->volumeRows.size());
+        for (auto i = 0; i < count; ++i) {
+            auto& row = this->volumeRows[i];
+            if (row.machines.test(machine) && row.backups.subtract(goneIds)) {
+                changedRows.push_back(i);
+            }
+        }
+        this->changedRuns(Table::Volumes, std::move(changedRows));
+    }
+
+    if (const auto it = this->sealedBackupIds.find({destination, machine});
+        it != this->sealedBackupIds.end()) {
+        it->subtract(removedIds);
+    }
+
+    if (const auto i = this->findMachine(machine); i >= 0) {
+        auto& backups = this->machineRows[i].backups;
+        const auto erased = backups.subtract(goneIds);
+        if (backups.merge(found) || erased) {
+            emit changed(Table::Machines, i, i);
+        }
+    }
+    return removedIds;
+}
+
+auto BackupCatalog::evictSealedBackups(std::size_t keep)
+    -> std::vector<QString>
+{
+    auto result = std::vector<QString>{};
+    if (this->backupRows.size() <= keep) {
+        return result;
+    }
+    auto candidates = std::vector<int>{};
+    const auto count = static_cast<int>(this->backupRows.size());
+    for (auto i = 0; i < count; ++i) {
+        const auto& row = this->backupRows[i];
+        if (row.sealed && !row.volumes.empty()) {
+            candidates.push_back(i);
+        }
+    }
+    const auto excess = std::min(candidates.size(),
+                                 this->backupRows.size() - keep);
+    if (excess == 0u) {
+        return result;
+    }
+    // Oldest first, by the times that the backups are named for.
+    const auto timestampOf = [this](int i){
+        return this->backupRows[i].timestamp.value_or(0);
+    };
+    std::nth_element(candidates.begin(),
+                     candidates.begin() + std::ptrdiff_t(excess) - 1,
+                     candidates.end(),
+                     [&](int a, int b){
+                         return timestampOf(a) < timestampOf(b);
+                     });
+    candidates.resize(excess);
+    auto evicted = QSet<BackupKey>{};
+    result.reserve(excess);
+    for (const auto i: candidates) {
+        evicted.insert(this->backupRows[i].key);
+        result.push_back(this->backupRows[i].path);
+    }
+    const auto isEvicted = [&](const BackupKey& key){
+        return evicted.contains(key);
+    };
+    this->pendingBackups.removeIf([&](QHash<BackupKey, Backup>::iterator it){
+        return isEvicted(it.key());
+    });
+    this->pendingBackupVolumes.removeIf([&](QHash<BackupKey, IdSet>::iterator it){
+        return isEvicted(it.key());
+    });
+    (void) this->removeIf(Table::Backups, this->backupRows,
+                          [&](const Backup& row){
+                              return isEvicted(row.key);
+                          });
+    reindex(this->backupRows, this->backupIndex, keyOfBackup);
+    return result;
+}
+
+void BackupCatalog::stageBackup(Backup values)
+{
+    const auto key = values.key;
+    this->pendingBackups.insert(key, std::move(values));
+}
+
+void BackupCatalog::stageBackupVolumes(const BackupKey& key, IdSet volumes)
+{
+    this->pendingBackupVolumes.insert(key, std::move(volumes));
+}
+
+void BackupCatalog::stageVolume(const QString& path,
+                                NameId name,
+                                const QString& uuid,
+                                const QString& type,
+                                const std::optional<qint64>& bytesUsed,
+                                NameId machine,
+                                NameId destination,
+                                NameId backup)
+{
+    const auto key = NameUuid{name, uuid};
+    auto it = this->pendingVolumes.find(key);
+    if (it == this->pendingVolumes.end()) {
+        it = this->pendingVolumes.insert(key, Volume{.name = name, .uuid = uuid});
+    }
+    auto& pending = it.value();
+    pending.path = path;
+    if (!type.isEmpty()) { // older backups don't store type attr
+        pending.type = type;
+    }
+    pending.maxUsed = std::max(pending.maxUsed, bytesUsed.value_or(0));
+    pending.machines.set(machine);
+    pending.destinations.set(destination);
+    pending.backups.set(backup);
+}
+
+void BackupCatalog::stageVolume(Volume values)
+{
+    const auto key = NameUuid{values.name, values.uuid};
+    auto it = this->pendingVolumes.find(key);
+    if (it == this->pendingVolumes.end()) {
+        this->pendingVolumes.insert(key, std::move(values));
+        return;
+    }
+    auto& pending = it.value();
+    if (!values.path.isEmpty()) {
+        pending.path = std::move(values.path);
+    }
+    if (!values.type.isEmpty()) {
+        pending.type = std::move(values.type);
+    }
+    pending.maxUsed = std::max(pending.maxUsed, values.maxUsed);
+    pending.machines.merge(values.machines);
+    pending.destinations.merge(values.destinations);
+    pending.backups.merge(values.backups);
+}
+
+auto BackupCatalog::hasPending() const noexcept -> bool
+{
+    return !this->pendingBackups.isEmpty() ||
+           !this->pendingBackupVolumes.isEmpty() ||
+           !this->pendingVolumes.isEmpty();
+}
+
+void BackupCatalog::applyPending()
+{
+    auto changedRows = std::vector<int>{};
+    auto addedBackups = std::vector<Backup>{};
+    for (auto it = this->pendingBackups.begin(); it != this->pendingBackups.end(); ++it) {
+        auto& values = it.value();
+        if (values.sealed) {
+            const auto& key = values.key;
+            this->sealedBackupIds[{key.destination, key.machine}].set(key.name);
+        }
+        const auto found = this->findBackup(values.key);
+        if (found < 0) {
+            // Give new backups their volumes up front to avoid refiltering.
+            if (const auto v = this->pendingBackupVolumes.constFind(values.key);
+                v != this->pendingBackupVolumes.constEnd()) {
+                values.volumes = *v;
+                this->pendingBackupVolumes.erase(v);
+            }
+            values.timestamp = parseBackupTimestamp(
+                this->catalogNames.backups.string(values.key.name));
+            addedBackups.push_back(std::move(values));
+            continue;
+        }
+        auto& row = this->backupRows[found];
+        values.volumes = std::move(row.volumes);
+        values.timestamp = row.timestamp;
+        if (row == values) {
+            row.volumes = std::move(values.volumes);
+            continue;
+        }
+        row = std::move(values);
+        changedRows.push_back(found);
+    }
+    this->pendingBackups.clear();
+    this->append(Table::Backups, this->backupRows, this->backupIndex,
+                 addedBackups, keyOfBackup);
+    for (auto it = this->pendingBackupVolumes.begin(); it != this->pendingBackupVolumes.end(); ++it) {
+        const auto found = this->findBackup(it.key());
+        if (found < 0) {
+            continue;
+        }
+        auto& row = this->backupRows[found];
+        if (row.volumes == it.value()) {
+            continue;
+        }
+        row.volumes = std::move(it.value());
+        changedRows.push_back(found);
+    }
+    this->pendingBackupVolumes.clear();
+    this->changedRuns(Table::Backups, std::move(changedRows));
+
+    changedRows.clear();
+    auto addedVolumes = std::vector<Volume>{};
+    for (auto it = this->pendingVolumes.begin(); it != this->pendingVolumes.end(); ++it) {
+        auto& pending = it.value();
+        const auto found = this->findVolume(pending.name, pending.uuid);
+        if (found < 0) {
+            addedVolumes.push_back(std::move(pending));
+            continue;
+        }
+        auto& row = this->volumeRows[found];
+        auto differs = (row.path != pending.path) ||
+                       (row.maxUsed < pending.maxUsed) ||
+                       (!pending.type.isEmpty() && (row.type != pending.type));
+        row.path = pending.path;
+        if (!pending.type.isEmpty()) {
+            row.type = pending.type;
+        }
+        row.maxUsed = std::max(row.maxUsed, pending.maxUsed);
+        differs = row.machines.merge(pending.machines) || differs;
+        differs = row.destinations.merge(pending.destinations) || differs;
+        differs = row.backups.merge(pending.backups) || differs;
+        if (differs) {
+            changedRows.push_back(found);
+        }
+    }
+    this->pendingVolumes.clear();
+    this->append(Table::Volumes, this->volumeRows, this->volumeIndex,
+                 addedVolumes, keyOfVolume);
+    this->changedRuns(Table::Volumes, std::move(changedRows));
+}
@@ -0,0 +1,272 @@
+#ifndef BACKUPCATALOG_H
+#define BACKUPCATALOG_H
+
+#include <chrono>
+#include <cstddef> // for std::size_t
+#include <optional>
+#include <utility> // for std::pair
+#include <vector>
+
+#include <QHash>
+#include <QObject>
+#include <QString>
+
+#include "catalognames.h"
+#include "idset.h"
+
+/// @brief In-memory catalog of the destinations, machines, volumes, &
+///   backups found.
+/// @note This is the one copy of what's been found, written to by the
+///   scanning of destinations & observed by any number of views. Each
+///   kind of entry is held in a vector, in the order found, with hash
+///   indices for finding entries by their identifying names. Relations
+///   between entries are held as sets of interned name identifiers.
+///   Backups & volumes are staged & then applied in batches, with
+///   changes signaled per contiguous run of entries. This depends only
+///   on QtCore, so it can be driven & measured without any widgets.
+class BackupCatalog : public QObject
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    enum class Table: int {
+        Destinations,
+        Machines,
+        Volumes,
+        Backups,
+    };
+    Q_ENUM(Table)
+
+    struct Destination {
+        QString id;
+        NameId name{};
+        QString kind;
+        QString mountPoint;
+
+        friend auto operator==(const Destination&, const Destination&)
+            -> bool = default;
+    };
+
+    struct Machine {
+        NameId name{};
+        QString uuid;
+        QString model;
+        QString address;
+        IdSet destinations;
+        IdSet volumes;
+        IdSet backups;
+    };
+
+    struct Volume {
+        NameId name{};
+        QString uuid;
+        QString type;
+        QString path;
+        qint64 maxUsed{};
+        IdSet machines;
+        IdSet destinations;
+        IdSet backups;
+    };
+
+    struct BackupKey {
+        NameId destination{};
+        NameId machine{};
+        NameId name{};
+
+        friend auto operator==(const BackupKey&, const BackupKey&)
+            -> bool = default;
+    };
+
+    struct Backup {
+        BackupKey key;
+        QString path;
+        QString type;
+        QString state;
+        std::optional<qint64> version;
+        std::optional<qint64> number;
+        std::optional<std::chrono::microseconds> started;
+        std::optional<std::chrono::microseconds> finished;
+        std::optional<qint64> size;
+        IdSet volumes;
+
+        /// @brief Whether the backup is complete & so won't change.
+        /// @see BackupRecord::sealed.
+        bool sealed{};
+
+        /// @brief Time the backup is named for, in seconds.
+        /// @note Set once when the backup is added to the catalog.
+        /// @see parseBackupTimestamp.
+        std::optional<qint64> timestamp;
+
+        friend auto operator==(const Backup&, const Backup&)
+            -> bool = default;
+    };
+
+    explicit BackupCatalog(QObject *parent = nullptr);
+
+    /// @brief Interned names that the identifiers of entries are from.
+    [[nodiscard]] auto names() noexcept -> CatalogNames&;
+    [[nodiscard]] auto names() const noexcept -> const CatalogNames&;
+
+    [[nodiscard]] auto destinations() const noexcept
+        -> const std::vector<Destination>&;
+    [[nodiscard]] auto machines() const noexcept
+        -> const std::vector<Machine>&;
+    [[nodiscard]] auto volumes() const noexcept
+        -> const std::vector<Volume>&;
+    [[nodiscard]] auto backups() const noexcept
+        -> const std::vector<Backup>&;
+
+    /// @brief Number of entries in the given table.
+    [[nodiscard]] auto size(Table table) const noexcept -> int;
+
+    /// @brief Finds the destination having the given ID.
+    /// @return Index of the destination or -1 if not found.
+    [[nodiscard]] auto findDestination(const QString& id) const -> int;
+
+    /// @brief Finds the machine having the given name & UUID.
+    /// @return Index of the machine or -1 if not found.
+    [[nodiscard]] auto findMachine(NameId name,
+                                   const QString& uuid) const -> int;
+
+    /// @brief Finds a machine having the given name regardless of UUID.
+    /// @return Index of the machine or -1 if not found.
+    [[nodiscard]] auto findMachine(NameId name) const -> int;
+
+    /// @brief Finds the volume having the given name & UUID.
+    /// @return Index of the volume or -1 if not found.
+    [[nodiscard]] auto findVolume(NameId name,
+                                  const QString& uuid) const -> int;
+
+    /// @brief Finds the backup for the given key.
+    /// @return Index of the backup or -1 if not found.
+    [[nodiscard]] auto findBackup(const BackupKey& key) const -> int;
+
+    /// @brief Identifiers of the sealed backups of the machine on the
+    ///   destination.
+    /// @note These only need their existence checked when refreshed.
+    [[nodiscard]] auto sealedBackups(NameId destination,
+                                     NameId machine) const -> IdSet;
+
+    /// @brief Reconciles the destinations with the given ones by ID.
+    /// @note Destinations not among those given are removed, those
+    ///   that differ are changed, & new ones are appended.
+    void setDestinations(std::vector<Destination> values);
+
+    /// @brief Updates the identified machine, adding it if new.
+    /// @return Index of the machine.
+    auto updateMachine(NameId name,
+                       const QString& uuid,
+                       const QString& model,
+                       const QString& address,
+                       NameId destination) -> int;
+
+    /// @brief Adds the given volume to those of the named machine.
+    void insertMachineVolume(NameId machine, NameId volume);
+
+    /// @brief Sets the backups found for the machine on the destination.
+    /// @note Backups of the machine on the destination that aren't
+    ///   among those found are removed, including any staged for
+    ///   them, & are erased from the machine & from its volumes unless
+    ///   the machine still has backups of the same names on other
+    ///   destinations.
+    /// @return Identifiers of the backups removed.
+    auto setMachineBackups(NameId destination,
+                           NameId machine,
+                           const IdSet& found) -> IdSet;
+
+    /// @brief Evicts the oldest sealed backups whose volumes are known,
+    ///   so no more than the given number of backups are kept.
+    /// @note Evicted backups are still held as sealed, so rescans only
+    ///   list them instead of staging them again, & are still among the
+    ///   backups of their machine & volumes till they're deleted.
+    /// @return Paths of the backups evicted.
+    auto evictSealedBackups(std::size_t keep) -> std::vector<QString>;
+
+    /// @brief Stages the given values for the next <code>applyPending</code>.
+    /// @note The volumes of an existing backup are kept. Staging the
+    ///   same key again before then replaces the earlier values. An
+    ///   existing backup is only signaled as changed if its values
+    ///   differ, so rescans don't reposition rows in sorted views.
+    void stageBackup(Backup values);
+
+    /// @brief Stages the volumes of the identified backup.
+    void stageBackupVolumes(const BackupKey& key, IdSet volumes);
+
+    /// @brief Stages an entry of the identified volume.
+    /// @note Entries staged for the same volume are merged.
+    void stageVolume(const QString& path,
+                     NameId name,
+                     const QString& uuid,
+                     const QString& type,
+                     const std::optional<qint64>& bytesUsed,
+                     NameId machine,
+                     NameId destination,
+                     NameId backup);
+
+    /// @brief Stages the given volume entry.
+    /// @note This is merged with any entries staged for the same
+    ///   volume, like those staged by name.
+    void stageVolume(Volume values);
+
+    [[nodiscard]] auto hasPending() const noexcept -> bool;
+
+    /// @brief Applies everything staged since the last call.
+    /// @note New entries are inserted as one range per table & changed
+    ///   entries are signaled per contiguous run, so observers see a
+    ///   single batch of changes instead of one per staged entry.
+    void applyPending();
+
+signals:
+    void aboutToInsert(BackupCatalog::Table table, int first, int last);
+    void inserted(BackupCatalog::Table table, int first, int last);
+    void aboutToRemove(BackupCatalog::Table table, int first, int last);
+    void removed(BackupCatalog::Table table, int first, int last);
+    void changed(BackupCatalog::Table table, int first, int last);
+
+private:
+    using NameUuid = std::pair<NameId, QString>;
+
+    /// @brief Destination & machine identifiers.
+    using MachineKey = std::pair<NameId, NameId>;
+
+    template <class T, class Index, class KeyOf>
+    void append(Table table,
+                std::vector<T>& rows,
+                Index& index,
+                std::vector<T>& added,
+                KeyOf keyOf);
+
+    template <class T, class Predicate>
+    auto removeIf(Table table,
+                  std::vector<T>& rows,
+                  Predicate predicate) -> bool;
+
+    void changedRuns(Table table, std::vector<int> indices);
+
+    CatalogNames catalogNames;
+
+    std::vector<Destination> destinationRows;
+    QHash<QString, int> destinationIndex;
+
+    std::vector<Machine> machineRows;
+    QHash<NameUuid, int> machineIndex;
+    QHash<NameId, int> machineNameIndex;
+
+    std::vector<Volume> volumeRows;
+    QHash<NameUuid, int> volumeIndex;
+    QHash<NameUuid, Volume> pendingVolumes;
+
+    std::vector<Backup> backupRows;
+    QHash<BackupKey, int> backupIndex;
+    QHash<BackupKey, Backup> pendingBackups;
+    QHash<BackupKey, IdSet> pendingBackupVolumes;
+    QHash<MachineKey, IdSet> sealedBackupIds;
+};
+
+auto qHash(const BackupCatalog::BackupKey& key, size_t seed = 0) noexcept
+    -> size_t;
+
+#endif // BACKUPCATALOG_H
@@ -0,0 +1,35 @@
+#ifndef BACKUPFILTER_H
+#define BACKUPFILTER_H
+
+#include "idset.h"
+
+/// @brief Which backups are shown, by the identifiers of the names of
+///   the destinations, machines, & volumes that are hidden.
+/// @note Filtering by what's hidden means backups of newly found
+///   destinations, machines, or volumes are shown. Each backup is
+///   tested with a couple of bit lookups & a word-wide pass over its
+///   volumes.
+struct BackupFilter
+{
+    IdSet hiddenDestinations;
+    IdSet hiddenMachines;
+    IdSet hiddenVolumes;
+
+    /// @brief Whether a backup of the given destination & machine, with
+    ///   the given volumes, is accepted.
+    /// @note Backups of hidden destinations or machines, or having no
+    ///   volume that isn't hidden, are rejected. Backups whose volumes
+    ///   haven't been read yet, so have none, are accepted, as they
+    ///   can't be known to only have hidden volumes.
+    [[nodiscard]] auto accepts(NameId destination,
+                               NameId machine,
+                               const IdSet& volumes) const noexcept
+        -> bool
+    {
+        return !this->hiddenDestinations.test(destination) &&
+               !this->hiddenMachines.test(machine) &&
+               (volumes.empty() || volumes.anyNotIn(this->hiddenVolumes));
+    }
+};
+
+#endif // BACKUPFILTER_H
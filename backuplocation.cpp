@@ -0,0 +1,37 @@
+#include "backuplocation.h"
+
+auto BackupLocation::mountPoint(const QString& destinationName,
+                                CatalogNames& names) -> BackupLocation
+{
+    return BackupLocation{
+        .level = Level::MountPoint,
+        .destination = names.destinations.intern(destinationName),
+    };
+}
+
+auto BackupLocation::child(const QString& name,
+                           CatalogNames& names) const
+    -> std::optional<BackupLocation>
+{
+    auto result = *this;
+    switch (this->level) {
+    case Level::MountPoint:
+        result.level = Level::StorageDir;
+        return result;
+    case Level::StorageDir:
+        result.level = Level::Machine;
+        result.machine = names.machines.intern(name);
+        return result;
+    case Level::Machine:
+        result.level = Level::Backup;
+        result.backup = names.backups.intern(name);
+        return result;
+    case Level::Backup:
+        result.level = Level::Volume;
+        result.volume = names.volumes.intern(name);
+        return result;
+    case Level::Volume:
+        break;
+    }
+    return {};
+}
@@ -0,0 +1,46 @@
+#ifndef BACKUPLOCATION_H
+#define BACKUPLOCATION_H
+
+#include <optional>
+
+#include <QString>
+
+#include "catalognames.h"
+
+/// @brief Where a path is within a Time Machine destination.
+/// @note Locations are made as scanning descends from a destination's
+///   mount point, each from the location of the directory it's in &
+///   the entry's filename, so the names a path is for are interned
+///   once instead of being recovered by walking the path backwards.
+struct BackupLocation
+{
+    /// @brief Depth of a location below its destination's mount point.
+    enum class Level: int {
+        MountPoint,
+        StorageDir, // like "Backups.backupdb"
+        Machine,
+        Backup,
+        Volume,
+    };
+
+    Level level{Level::MountPoint};
+    NameId destination{};
+    NameId machine{};
+    NameId backup{};
+    NameId volume{};
+
+    /// @brief Location of the destination with the given name.
+    static auto mountPoint(const QString& destinationName,
+                           CatalogNames& names) -> BackupLocation;
+
+    /// @brief Location of the named entry within this location.
+    /// @return Location or no value if this is already a volume.
+    [[nodiscard]] auto child(const QString& name,
+                             CatalogNames& names) const
+        -> std::optional<BackupLocation>;
+
+    friend auto operator==(const BackupLocation&, const BackupLocation&)
+        -> bool = default;
+};
+
+#endif // BACKUPLOCATION_H
@@ -0,0 +1,41 @@
+#include "backupsfiltermodel.h"
+#include "backupsmodel.h"
+
+BackupsFilterModel::BackupsFilterModel(QObject *parent):
+    CatalogSortModel{parent}
+{
+}
+
+void BackupsFilterModel::setDestinationHidden(NameId id, bool hidden)
+{
+    if (this->filter.hiddenDestinations.assign(id, hidden)) {
+        this->invalidateRowsFilter();
+    }
+}
+
+void BackupsFilterModel::setMachineHidden(NameId id, bool hidden)
+{
+    if (this->filter.hiddenMachines.assign(id, hidden)) {
+        this->invalidateRowsFilter();
+    }
+}
+
+void BackupsFilterModel::setVolumeHidden(NameId id, bool hidden)
+{
+    if (this->filter.hiddenVolumes.assign(id, hidden)) {
+        this->invalidateRowsFilter();
+    }
+}
+
+auto BackupsFilterModel::filterAcceptsRow(int sourceRow,
+                                          const QModelIndex &) const
+    -> bool
+{
+    const auto model = qobject_cast<const BackupsModel*>(this->sourceModel());
+    if (!model) {
+        return true;
+    }
+    const auto& row = model->row(sourceRow);
+    return this->filter.accepts(row.key.destination, row.key.machine,
+                                row.volumes);
+}
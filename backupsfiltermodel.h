@@ -0,0 +1,31 @@
+#ifndef BACKUPSFILTERMODEL_H
+#define BACKUPSFILTERMODEL_H
+
+#include "catalogsortmodel.h"
+#include "backupfilter.h"
+
+/// @brief Sorting & filtering proxy for a <code>BackupsModel</code>.
+/// @see BackupFilter for which rows are accepted.
+class BackupsFilterModel : public CatalogSortModel
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    explicit BackupsFilterModel(QObject *parent = nullptr);
+
+    void setDestinationHidden(NameId id, bool hidden);
+    void setMachineHidden(NameId id, bool hidden);
+    void setVolumeHidden(NameId id, bool hidden);
+
+protected:
+    [[nodiscard]] auto filterAcceptsRow(int sourceRow,
+                                        const QModelIndex &sourceParent) const
+        -> bool override;
+
+private:
+    BackupFilter filter;
+};
+
+#endif // BACKUPSFILTERMODEL_H
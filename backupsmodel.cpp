@@ -0,0 +1,237 @@
+#include <algorithm> // for std::minmax
+
+#include <QDateTime>
+#include <QFontDatabase>
+
+#include "backupsmodel.h"
+#include "seconds.h"
+#include "catalognames.h"
+#include "idsetstrings.h"
+#include "tablecolumndata.h"
+
+namespace {
+
+constexpr auto alignRight = Qt::AlignRight|Qt::AlignVCenter;
+
+auto duration(const std::optional<std::chrono::microseconds>& t0,
+              const std::optional<std::chrono::microseconds>& t1)
+    -> std::optional<std::chrono::seconds>
+{
+    if (t0 && t1) {
+        const auto minmax = std::minmax(*t0, *t1);
+        return {
+            std::chrono::duration_cast<std::chrono::seconds>(
+                (minmax.second - minmax.first))
+        };
+    }
+    return {};
+}
+
+auto toMilliseconds(const std::chrono::microseconds t)
+    -> std::chrono::milliseconds
+{
+    using namespace std::chrono;
+    return duration_cast<milliseconds>(t);
+}
+
+auto durationToolTip(const std::optional<std::chrono::microseconds>& t0,
+                     const std::optional<std::chrono::microseconds>& t1)
+    -> QString
+{
+    const auto unknown = QString{"unknown"};
+    const auto t0String = t0
+        ? QDateTime::fromMSecsSinceEpoch(toMilliseconds(*t0).count()).toString()
+        : unknown;
+    const auto t1String = t1
+        ? QDateTime::fromMSecsSinceEpoch(toMilliseconds(*t1).count()).toString()
+        : unknown;
+    return QString{"%1...%2"}.arg(t0String, t1String);
+}
+
+template <class T>
+auto toVariant(const std::optional<T>& value) -> QVariant
+{
+    return value? QVariant::fromValue(*value): QVariant{};
+}
+
+auto toSortKey(const std::optional<qint64>& value) -> SortKey
+{
+    return value? SortKey{*value}: SortKey{};
+}
+
+}
+
+BackupsModel::BackupsModel(const BackupCatalog *catalog, QObject *parent):
+    CatalogTableModel{catalog, BackupCatalog::Table::Backups,
+                      BackupsColumn::count, parent},
+    fixedFont{QFontDatabase::systemFont(QFontDatabase::FixedFont)}
+{
+}
+
+auto BackupsModel::data(const QModelIndex &index, int role) const
+    -> QVariant
+{
+    if (!index.isValid()) {
+        return {};
+    }
+    if (role == SortRole) {
+        return toVariant(this->sortKey(index.row(), index.column()));
+    }
+    const auto& names = this->catalog().names();
+    const auto& row = this->catalog().backups()[index.row()];
+    const auto column = index.column();
+    switch (role) {
+    case Qt::DisplayRole:
+        switch (column) {
+        case BackupsColumn::Name:
+            return names.backups.string(row.key.name);
+        case BackupsColumn::Type:
+            return row.type;
+        case BackupsColumn::State:
+            return row.state;
+        case BackupsColumn::Version:
+            return toVariant(row.version);
+        case BackupsColumn::Number:
+            return toVariant(row.number);
+        case BackupsColumn::Duration:
+            if (const auto value = duration(row.started, row.finished)) {
+                return toString(*value);
+            }
+            return {};
+        case BackupsColumn::Size:
+            return toVariant(row.size);
+        case BackupsColumn::Volumes:
+            return qsizetype(row.volumes.count());
+        case BackupsColumn::Machine:
+            return names.machines.string(row.key.machine);
+        case BackupsColumn::Destination:
+            return names.destinations.string(row.key.destination);
+        }
+        break;
+    case Qt::UserRole:
+        if (column == BackupsColumn::Name) {
+            return row.path;
+        }
+        break;
+    case Qt::ToolTipRole:
+        switch (column) {
+        case BackupsColumn::Duration:
+            return durationToolTip(row.started, row.finished);
+        case BackupsColumn::Volumes:
+            return toStringList(row.volumes, names.volumes,
+                                maxToolTipStringList).join(", ");
+        }
+        break;
+    case Qt::FontRole:
+        switch (column) {
+        case BackupsColumn::Name:
+        case BackupsColumn::Version:
+        case BackupsColumn::Number:
+        case BackupsColumn::Duration:
+        case BackupsColumn::Size:
+        case BackupsColumn::Volumes:
+            return this->fixedFont;
+        }
+        break;
+    case Qt::TextAlignmentRole:
+        switch (column) {
+        case BackupsColumn::Version:
+        case BackupsColumn::Number:
+        case BackupsColumn::Duration:
+        case BackupsColumn::Size:
+        case BackupsColumn::Volumes:
+            return QVariant::fromValue(alignRight);
+        }
+        return QVariant::fromValue(Qt::Alignment{Qt::AlignCenter});
+    }
+    return {};
+}
+
+auto BackupsModel::sortKey(int row, int column) const -> SortKey
+{
+    const auto& names = this->catalog().names();
+    const auto& entry = this->catalog().backups()[row];
+    switch (column) {
+    case BackupsColumn::Name:
+        if (entry.timestamp) {
+            return *entry.timestamp;
+        }
+        return names.backups.string(entry.key.name);
+    case BackupsColumn::Type:
+        return entry.type;
+    case BackupsColumn::State:
+        return entry.state;
+    case BackupsColumn::Version:
+        return toSortKey(entry.version);
+    case BackupsColumn::Number:
+        return toSortKey(entry.number);
+    case BackupsColumn::Duration:
+        if (const auto value = duration(entry.started, entry.finished)) {
+            return qint64(value->count());
+        }
+        return {};
+    case BackupsColumn::Size:
+        return toSortKey(entry.size);
+    case BackupsColumn::Volumes:
+        return qint64(entry.volumes.count());
+    case BackupsColumn::Machine:
+        return names.machines.string(entry.key.machine);
+    case BackupsColumn::Destination:
+        return names.destinations.string(entry.key.destination);
+    }
+    return {};
+}
+
+auto BackupsModel::headerData(int section,
+                              Qt::Orientation orientation,
+                              int role) const -> QVariant
+{
+    static const auto columns = std::map<int, TableColumnData>{
+        {BackupsColumn::Name, {"Name", "Backup name."}},
+        {BackupsColumn::Type, {"Type", "Backup daemon snapshot type."}},
+        {BackupsColumn::State, {"State", "Backup state."}},
+        {BackupsColumn::Version,
+         {"Version",
+          "Backup snapshot version.",
+          Qt::AlignTrailing|Qt::AlignVCenter}},
+        {BackupsColumn::Number,
+         {"Number",
+          "Backup \"number\".",
+          Qt::AlignTrailing|Qt::AlignVCenter}},
+        {BackupsColumn::Duration,
+         {"Duration",
+          "Backup daemon snapshot time elapsed.",
+          Qt::AlignTrailing|Qt::AlignVCenter}},
+        {BackupsColumn::Size,
+         {"Copied Size",
+          "Backup daemon snapshot total bytes copied.",
+          Qt::AlignTrailing|Qt::AlignVCenter}},
+        {BackupsColumn::Volumes,
+         {"Volumes",
+          "Number of volumes in the backup.",
+          Qt::AlignTrailing|Qt::AlignVCenter}},
+        {BackupsColumn::Machine,
+         {"Machine",
+          "Machine for which the backup was made."}},
+        {BackupsColumn::Destination,
+         {"Destination",
+          "Time machine destination on which the backup is stored."}},
+    };
+    if (orientation != Qt::Horizontal) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+    return ::headerData(columns, section, role);
+}
+
+auto BackupsModel::flags(const QModelIndex &index) const
+    -> Qt::ItemFlags
+{
+    return index.isValid()
+        ? Qt::ItemIsEnabled|Qt::ItemIsSelectable
+        : Qt::NoItemFlags;
+}
+
+auto BackupsModel::row(int index) const -> const BackupCatalog::Backup&
+{
+    return this->catalog().backups()[index];
+}
@@ -0,0 +1,54 @@
+#ifndef BACKUPSMODEL_H
+#define BACKUPSMODEL_H
+
+#include <QFont>
+
+#include "catalogtablemodel.h"
+
+// A namespace scoped enum for the backups table columns...
+namespace BackupsColumn {
+enum Enum: int {
+    Name = 0,
+    Type,
+    State,
+    Version,
+    Number,
+    Duration,
+    Size,
+    Volumes,
+    Machine,
+    Destination,
+};
+constexpr auto count = 10;
+}
+
+/// @brief Model for the backups table of a <code>BackupCatalog</code>.
+class BackupsModel : public CatalogTableModel
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    explicit BackupsModel(const BackupCatalog *catalog,
+                          QObject *parent = nullptr);
+
+    [[nodiscard]] auto data(const QModelIndex &index,
+                            int role = Qt::DisplayRole) const
+        -> QVariant override;
+    [[nodiscard]] auto sortKey(int row, int column) const
+        -> SortKey override;
+    [[nodiscard]] auto headerData(int section,
+                                  Qt::Orientation orientation,
+                                  int role = Qt::DisplayRole) const
+        -> QVariant override;
+    [[nodiscard]] auto flags(const QModelIndex &index) const
+        -> Qt::ItemFlags override;
+
+    [[nodiscard]] auto row(int index) const -> const BackupCatalog::Backup&;
+
+private:
+    QFont fixedFont;
+};
+
+#endif // BACKUPSMODEL_H
@@ -0,0 +1,64 @@
+#include <chrono>
+
+#include "backuptimestamp.h"
+
+namespace {
+
+constexpr auto timestampLength = qsizetype{17}; // YYYY-MM-DD-HHMMSS
+
+/// @brief Gets the decimal number of the given digits.
+/// @return Number or -1 if any character isn't a digit.
+auto toNumber(QStringView digits) noexcept -> int
+{
+    auto result = 0;
+    for (const auto c: digits) {
+        const auto u = c.unicode();
+        if ((u < u'0') || (u > u'9')) {
+            return -1;
+        }
+        constexpr auto base = 10;
+        result = (result * base) + (u - u'0');
+    }
+    return result;
+}
+
+}
+
+auto parseBackupTimestamp(QStringView name) noexcept
+    -> std::optional<qint64>
+{
+    if ((name.size() < timestampLength) ||
+        ((name.size() > timestampLength) && (name[timestampLength] != u'.')) ||
+        (name[4] != u'-') || (name[7] != u'-') || (name[10] != u'-')) {
+        return {};
+    }
+    const auto year = toNumber(name.sliced(0, 4));
+    const auto month = toNumber(name.sliced(5, 2));
+    const auto day = toNumber(name.sliced(8, 2));
+    const auto hours = toNumber(name.sliced(11, 2));
+    const auto minutes = toNumber(name.sliced(13, 2));
+    const auto seconds = toNumber(name.sliced(15, 2));
+    constexpr auto maxHours = 23;
+    constexpr auto maxMinutes = 59;
+    constexpr auto maxSeconds = 60; // allow for a leap second
+    if ((year < 0) || (month < 0) || (day < 0) ||
+        (hours < 0) || (hours > maxHours) ||
+        (minutes < 0) || (minutes > maxMinutes) ||
+        (seconds < 0) || (seconds > maxSeconds)) {
+        return {};
+    }
+    using namespace std::chrono;
+    const auto date = year_month_day{
+        std::chrono::year{year},
+        std::chrono::month{static_cast<unsigned>(month)},
+        std::chrono::day{static_cast<unsigned>(day)}
+    };
+    if (!date.ok()) {
+        return {};
+    }
+    const auto time = sys_days{date}.time_since_epoch() +
+                      std::chrono::hours{hours} +
+                      std::chrono::minutes{minutes} +
+                      std::chrono::seconds{seconds};
+    return {duration_cast<std::chrono::seconds>(time).count()};
+}
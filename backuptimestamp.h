@@ -0,0 +1,19 @@
+#ifndef BACKUPTIMESTAMP_H
+#define BACKUPTIMESTAMP_H
+
+#include <optional>
+
+#include <QStringView>
+
+/// @brief Parses the time a backup is named for.
+/// @note Backup names are of the form <code>YYYY-MM-DD-HHMMSS</code>,
+///   optionally followed by an extension like <code>.backup</code>
+///   or <code>.inprogress</code>. The result is in seconds since the
+///   epoch, taking the name's local time as if it were UTC, which
+///   orders backups the same as their names do without the cost of
+///   time zone lookups.
+/// @return Seconds or no value if the name isn't of that form.
+auto parseBackupTimestamp(QStringView name) noexcept
+    -> std::optional<qint64>;
+
+#endif // BACKUPTIMESTAMP_H
@@ -0,0 +1,184 @@
+#include <algorithm> // for std::sort
+#include <cstdint>
+#include <memory>
+#include <numeric> // for std::iota
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <QSortFilterProxyModel>
+#include <QString>
+#include <QVariant>
+
+#include "backupcatalog.h"
+#include "backuptimestamp.h"
+#include "catalogsortmodel.h"
+#include "catalogtablemodel.h"
+#include "sortkey.h"
+
+namespace {
+
+constexpr auto rowCount = 100'000;
+
+/// @brief Names of backups in a shuffled order, like rows as found.
+auto backupNames() -> std::vector<QString>
+{
+    auto result = std::vector<QString>{};
+    result.reserve(rowCount);
+    auto state = std::uint32_t{1};
+    for (auto i = 0; i < rowCount; ++i) {
+        // Linear congruential generator, so every run sorts the same rows.
+        state = (state * 1664525u) + 1013904223u;
+        const auto r = state >> 8u;
+        result.push_back(QString::asprintf("%04u-%02u-%02u-%02u%02u%02u.backup",
+                                           2015u + (r % 10u),
+                                           1u + ((r / 10u) % 12u),
+                                           1u + ((r / 120u) % 28u),
+                                           (r / 3360u) % 24u,
+                                           (r / 80640u) % 60u,
+                                           unsigned(i % 60)));
+    }
+    return result;
+}
+
+/// @brief Model of the names of a catalog's backups, as the backups
+///   table presents them.
+class BackupNamesModel : public CatalogTableModel
+{
+public:
+    explicit BackupNamesModel(const BackupCatalog *catalog):
+        CatalogTableModel{catalog, BackupCatalog::Table::Backups, 1}
+    {
+    }
+
+    [[nodiscard]] auto data(const QModelIndex &index, int role) const
+        -> QVariant override
+    {
+        if (role == Qt::DisplayRole) {
+            const auto& entry = this->catalog().backups()[index.row()];
+            return this->catalog().names().backups.string(entry.key.name);
+        }
+        if (role == SortRole) {
+            return toVariant(this->sortKey(index.row(), index.column()));
+        }
+        return {};
+    }
+
+    [[nodiscard]] auto sortKey(int row, int) const -> SortKey override
+    {
+        const auto& entry = this->catalog().backups()[row];
+        if (entry.timestamp) {
+            return *entry.timestamp;
+        }
+        return this->catalog().names().backups.string(entry.key.name);
+    }
+};
+
+auto makeCatalog() -> std::unique_ptr<BackupCatalog>
+{
+    auto result = std::make_unique<BackupCatalog>();
+    auto& names = result->names();
+    const auto destination = names.destinations.intern("Destination");
+    const auto machine = names.machines.intern("Machine");
+    for (const auto& name: backupNames()) {
+        result->stageBackup({
+            .key = {destination, machine, names.backups.intern(name)},
+        });
+    }
+    result->applyPending();
+    return result;
+}
+
+void sortProxy(benchmark::State& state, QSortFilterProxyModel& proxy)
+{
+    auto order = Qt::AscendingOrder;
+    for (auto _: state) {
+        // Alternating the order makes every sort a whole one.
+        order = (order == Qt::AscendingOrder)
+            ? Qt::DescendingOrder
+            : Qt::AscendingOrder;
+        proxy.sort(0, order);
+        benchmark::DoNotOptimize(proxy.index(0, 0));
+    }
+    state.SetItemsProcessed(state.iterations() * proxy.rowCount());
+}
+
+void sortProxyByKeys(benchmark::State& state)
+{
+    // As the tables sort: by each cell's key, through its model.
+    const auto catalog = makeCatalog();
+    auto model = BackupNamesModel{catalog.get()};
+    auto proxy = CatalogSortModel{};
+    proxy.setSourceModel(&model);
+    sortProxy(state, proxy);
+}
+
+void sortProxyByVariants(benchmark::State& state)
+{
+    // As before sort keys: by the display data of each cell.
+    const auto catalog = makeCatalog();
+    auto model = BackupNamesModel{catalog.get()};
+    auto proxy = QSortFilterProxyModel{};
+    proxy.setSourceModel(&model);
+    sortProxy(state, proxy);
+}
+
+void sortByNameKeys(benchmark::State& state)
+{
+    // Keys are computed when backups are added, not while sorting.
+    const auto names = backupNames();
+    auto keys = std::vector<SortKey>{};
+    keys.reserve(names.size());
+    for (const auto& name: names) {
+        const auto timestamp = parseBackupTimestamp(name);
+        keys.push_back(timestamp? SortKey{*timestamp}: SortKey{name});
+    }
+    auto rows = std::vector<int>(names.size());
+    for (auto _: state) {
+        std::iota(rows.begin(), rows.end(), 0);
+        std::sort(rows.begin(), rows.end(), [&](int lhs, int rhs){
+            return keys[lhs] < keys[rhs];
+        });
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetItemsProcessed(state.iterations() * rowCount);
+}
+
+void sortByNameVariants(benchmark::State& state)
+{
+    // As before sort keys: each comparison gets both cells' data as
+    // variants of their display strings & compares those.
+    const auto names = backupNames();
+    auto rows = std::vector<int>(names.size());
+    for (auto _: state) {
+        std::iota(rows.begin(), rows.end(), 0);
+        std::sort(rows.begin(), rows.end(), [&](int lhs, int rhs){
+            return QVariant::compare(QVariant{names[lhs]},
+                                     QVariant{names[rhs]}) ==
+                   QPartialOrdering::Less;
+        });
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetItemsProcessed(state.iterations() * rowCount);
+}
+
+void parseNames(benchmark::State& state)
+{
+    const auto names = backupNames();
+    for (auto _: state) {
+        for (const auto& name: names) {
+            benchmark::DoNotOptimize(parseBackupTimestamp(name));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * rowCount);
+}
+
+}
+
+BENCHMARK(sortByNameKeys)->Unit(benchmark::kMillisecond);
+BENCHMARK(sortByNameVariants)->Unit(benchmark::kMillisecond);
+BENCHMARK(parseNames)->Unit(benchmark::kMillisecond);
+BENCHMARK(sortProxyByKeys)->Unit(benchmark::kMillisecond);
+BENCHMARK(sortProxyByVariants)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,480 @@
+#include <array>
+#include <bit> // for std::endian
+#include <cstring> // for std::memcpy
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QSaveFile>
+#include <QSet>
+#include <QStandardPaths>
+#include <QtDebug>
+
+#include "backupcatalog.h"
+#include "catalogcache.h"
+
+static_assert(std::endian::native == std::endian::little,
+              "cache files are little-endian & records are copied as is");
+
+namespace {
+
+constexpr auto fileMagic = std::array<char, 4>{'T', 'M', 'H', 'C'};
+constexpr auto fileSuffix = ".tmhc";
+constexpr auto directoryName = "catalogs";
+
+// A file is laid out as its header followed by the machine, volume, &
+// backup records, the string index array that records' ranges are
+// into, the offsets of the strings (one more than their number), &
+// the strings' UTF-8 data. Each record's size is a multiple of 8 bytes
+// so that records stay naturally aligned within a mapped file.
+
+struct Header {
+    std::array<char, 4> magic;
+    quint32 version;
+    quint32 destination; // string index of the destination's name
+    quint32 strings;
+    quint32 machines;
+    quint32 volumes;
+    quint32 backups;
+    quint32 ids;
+};
+
+/// @brief Range of entries of the string index array.
+struct Range {
+    quint32 first;
+    quint32 count;
+};
+
+struct MachineRecord {
+    quint32 name;
+    quint32 uuid;
+    quint32 model;
+    quint32 address;
+    Range volumes;
+};
+
+struct VolumeRecord {
+    quint32 name;
+    quint32 uuid;
+    quint32 type;
+    quint32 path;
+    qint64 maxUsed;
+    Range machines;
+    Range backups;
+};
+
+enum BackupFlag: quint32 {
+    hasVersion  = 0x01,
+    hasNumber   = 0x02,
+    hasStarted  = 0x04,
+    hasFinished = 0x08,
+    hasSize     = 0x10,
+    isSealed    = 0x20,
+};
+
+struct BackupRecord {
+    quint32 machine;
+    quint32 name;
+    quint32 path;
+    quint32 type;
+    quint32 state;
+    quint32 flags;
+    qint64 version;
+    qint64 number;
+    qint64 started;  // microseconds since the epoch
+    qint64 finished; // microseconds since the epoch
+    qint64 size;
+    Range volumes;
+};
+
+static_assert(sizeof(Header) % 8 == 0);
+static_assert(sizeof(MachineRecord) % 8 == 0);
+static_assert(sizeof(VolumeRecord) % 8 == 0);
+static_assert(sizeof(BackupRecord) % 8 == 0);
+
+class StringTable
+{
+public:
+    auto add(const QString& string) -> quint32
+    {
+        if (const auto it = this->index.constFind(string);
+            it != this->index.constEnd()) {
+            return *it;
+        }
+        const auto result = static_cast<quint32>(this->strings.size());
+        this->index.insert(string, result);
+        this->strings.push_back(string.toUtf8());
+        return result;
+    }
+
+    [[nodiscard]] auto values() const noexcept
+        -> const std::vector<QByteArray>&
+    {
+        return this->strings;
+    }
+
+private:
+    QHash<QString, quint32> index;
+    std::vector<QByteArray> strings;
+};
+
+template <class T>
+void append(QByteArray& bytes, const std::vector<T>& values)
+{
+    bytes.append(reinterpret_cast<const char*>(values.data()),
+                 static_cast<qsizetype>(values.size() * sizeof(T)));
+}
+
+/// @brief View of an array of records within mapped bytes.
+/// @note Records are copied out one at a time, so nothing depends on
+///   the alignment of the mapping.
+template <class T>
+class Table
+{
+public:
+    /// @brief Gets the table of the given count at the given offset.
+    /// @note The offset is advanced past the table.
+    /// @return Table or no value if the bytes are too few.
+    static auto at(std::span<const uchar> bytes,
+                   std::size_t& offset,
+                   std::size_t count) -> std::optional<Table>
+    {
+        if (count > ((bytes.size() - offset) / sizeof(T))) {
+            return {};
+        }
+        auto result = Table{};
+        result.data = bytes.data() + offset;
+        result.count = count;
+        offset += count * sizeof(T);
+        return result;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return this->count;
+    }
+
+    auto operator[](std::size_t i) const noexcept -> T
+    {
+        auto result = T{};
+        std::memcpy(&result, this->data + (i * sizeof(T)), sizeof(T));
+        return result;
+    }
+
+private:
+    const uchar *data{};
+    std::size_t count{};
+};
+
+auto load(BackupCatalog& catalog, std::span<const uchar> bytes) -> bool
+{
+    auto header = Header{};
+    if (bytes.size() < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if ((header.magic != fileMagic) ||
+        (header.version != CatalogCache::version)) {
+        return false;
+    }
+    auto offset = sizeof(header);
+    const auto machines = Table<MachineRecord>::at(bytes, offset, header.machines);
+    const auto volumes = Table<VolumeRecord>::at(bytes, offset, header.volumes);
+    const auto backups = Table<BackupRecord>::at(bytes, offset, header.backups);
+    const auto ids = Table<quint32>::at(bytes, offset, header.ids);
+    const auto offsets = Table<quint32>::at(bytes, offset,
+                                            std::size_t{header.strings} + 1u);
+    if (!machines || !volumes || !backups || !ids || !offsets) {
+        return false;
+    }
+    const auto data = bytes.subspan(offset);
+
+    // Decode each string once, rather than once per reference to it.
+    auto strings = std::vector<QString>{};
+    strings.reserve(header.strings);
+    for (auto i = std::size_t{0}; i < header.strings; ++i) {
+        const auto first = (*offsets)[i];
+        const auto last = (*offsets)[i + 1u];
+        if ((first > last) || (last > data.size())) {
+            return false;
+        }
+        strings.push_back(QString::fromUtf8(
+            reinterpret_cast<const char*>(data.data() + first),
+            static_cast<qsizetype>(last - first)));
+    }
+    const auto string = [&strings](quint32 i){
+        return (i < strings.size())? strings[i]: QString{};
+    };
+    const auto idsOf = [&](Range range, StringInterner& interner){
+        auto result = IdSet{};
+        const auto last = std::min(std::size_t{range.first} + range.count,
+                                   ids->size());
+        for (auto i = std::size_t{range.first}; i < last; ++i) {
+            result.set(interner.intern(string((*ids)[i])));
+        }
+        return result;
+    };
+
+    auto& names = catalog.names();
+    const auto destination = names.destinations.intern(string(header.destination));
+    for (auto i = std::size_t{0}; i < machines->size(); ++i) {
+        const auto record = (*machines)[i];
+        const auto machine = names.machines.intern(string(record.name));
+        (void) catalog.updateMachine(machine,
+                                     string(record.uuid),
+                                     string(record.model),
+                                     string(record.address),
+                                     destination);
+        idsOf(record.volumes, names.volumes).forEach([&](NameId volume){
+            catalog.insertMachineVolume(machine, volume);
+        });
+    }
+    auto machineBackups = QHash<NameId, IdSet>{};
+    for (auto i = std::size_t{0}; i < backups->size(); ++i) {
+        const auto record = (*backups)[i];
+        const auto key = BackupCatalog::BackupKey{
+            .destination = destination,
+            .machine = names.machines.intern(string(record.machine)),
+            .name = names.backups.intern(string(record.name)),
+        };
+        const auto optional = [&record](BackupFlag flag, qint64 value){
+            return (record.flags & flag)
+                ? std::optional<qint64>{value}
+                : std::nullopt;
+        };
+        const auto time = [&record](BackupFlag flag, qint64 value){
+            return (record.flags & flag)
+                ? std::optional{std::chrono::microseconds{value}}
+                : std::nullopt;
+        };
+        catalog.stageBackup({
+            .key = key,
+            .path = string(record.path),
+            .type = string(record.type),
+            .state = string(record.state),
+            .version = optional(hasVersion, record.version),
+            .number = optional(hasNumber, record.number),
+            .started = time(hasStarted, record.started),
+            .finished = time(hasFinished, record.finished),
+            .size = optional(hasSize, record.size),
+            .sealed = (record.flags & isSealed) != 0u,
+        });
+        catalog.stageBackupVolumes(key, idsOf(record.volumes, names.volumes));
+        machineBackups[key.machine].set(key.name);
+    }
+    for (auto it = machineBackups.cbegin(); it != machineBackups.cend(); ++it) {
+        (void) catalog.setMachineBackups(destination, it.key(), it.value());
+    }
+    for (auto i = std::size_t{0}; i < volumes->size(); ++i) {
+        const auto record = (*volumes)[i];
+        auto destinations = IdSet{};
+        destinations.set(destination);
+        catalog.stageVolume(BackupCatalog::Volume{
+            .name = names.volumes.intern(string(record.name)),
+            .uuid = string(record.uuid),
+            .type = string(record.type),
+            .path = string(record.path),
+            .maxUsed = record.maxUsed,
+            .machines = idsOf(record.machines, names.machines),
+            .destinations = std::move(destinations),
+            .backups = idsOf(record.backups, names.backups),
+        });
+    }
+    catalog.applyPending();
+    return true;
+}
+
+}
+
+namespace CatalogCache {
+
+auto directory() -> QString
+{
+    const auto appData =
+        QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    return QDir{appData}.filePath(directoryName);
+}
+
+auto fileName(const QString& destinationId) -> QString
+{
+    return QDir{directory()}.filePath(destinationId + fileSuffix);
+}
+
+auto save(const BackupCatalog& catalog,
+          NameId destination,
+          const QString& fileName) -> bool
+{
+    const auto& names = catalog.names();
+    auto strings = StringTable{};
+    auto ids = std::vector<quint32>{};
+    const auto rangeOf = [&](const IdSet& set, const StringInterner& interner){
+        auto result = Range{static_cast<quint32>(ids.size()), 0u};
+        set.forEach([&](NameId id){
+            ids.push_back(strings.add(interner.string(id)));
+            ++result.count;
+        });
+        return result;
+    };
+
+    auto header = Header{
+        .magic = fileMagic,
+        .version = version,
+        .destination = strings.add(names.destinations.string(destination)),
+    };
+    auto machines = std::vector<MachineRecord>{};
+    for (const auto& row: catalog.machines()) {
+        if (!row.destinations.test(destination)) {
+            continue;
+        }
+        machines.push_back({
+            .name = strings.add(names.machines.string(row.name)),
+            .uuid = strings.add(row.uuid),
+            .model = strings.add(row.model),
+            .address = strings.add(row.address),
+            .volumes = rangeOf(row.volumes, names.volumes),
+        });
+    }
+    auto volumes = std::vector<VolumeRecord>{};
+    for (const auto& row: catalog.volumes()) {
+        if (!row.destinations.test(destination)) {
+            continue;
+        }
+        volumes.push_back({
+            .name = strings.add(names.volumes.string(row.name)),
+            .uuid = strings.add(row.uuid),
+            .type = strings.add(row.type),
+            .path = strings.add(row.path),
+            .maxUsed = row.maxUsed,
+            .machines = rangeOf(row.machines, names.machines),
+            .backups = rangeOf(row.backups, names.backups),
+        });
+    }
+    auto backups = std::vector<BackupRecord>{};
+    for (const auto& row: catalog.backups()) {
+        if (row.key.destination != destination) {
+            continue;
+        }
+        const auto flag = [](bool value, BackupFlag flag){
+            return value? quint32{flag}: 0u;
+        };
+        backups.push_back({
+            .machine = strings.add(names.machines.string(row.key.machine)),
+            .name = strings.add(names.backups.string(row.key.name)),
+            .path = strings.add(row.path),
+            .type = strings.add(row.type),
+            .state = strings.add(row.state),
+            .flags = flag(row.version.has_value(), hasVersion) |
+                     flag(row.number.has_value(), hasNumber) |
+                     flag(row.started.has_value(), hasStarted) |
+                     flag(row.finished.has_value(), hasFinished) |
+                     flag(row.size.has_value(), hasSize) |
+                     flag(row.sealed, isSealed),
+            .version = row.version.value_or(0),
+            .number = row.number.value_or(0),
+            .started = row.started.value_or(std::chrono::microseconds{}).count(),
+            .finished = row.finished.value_or(std::chrono::microseconds{}).count(),
+            .size = row.size.value_or(0),
+            .volumes = rangeOf(row.volumes, names.volumes),
+        });
+    }
+    header.strings = static_cast<quint32>(strings.values().size());
+    header.machines = static_cast<quint32>(machines.size());
+    header.volumes = static_cast<quint32>(volumes.size());
+    header.backups = static_cast<quint32>(backups.size());
+    header.ids = static_cast<quint32>(ids.size());
+
+    auto offsets = std::vector<quint32>{};
+    offsets.reserve(strings.values().size() + 1u);
+    auto total = quint32{0};
+    for (const auto& value: strings.values()) {
+        offsets.push_back(total);
+        total += static_cast<quint32>(value.size());
+    }
+    offsets.push_back(total);
+
+    auto bytes = QByteArray{};
+    bytes.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    append(bytes, machines);
+    append(bytes, volumes);
+    append(bytes, backups);
+    append(bytes, ids);
+    append(bytes, offsets);
+    for (const auto& value: strings.values()) {
+        bytes.append(value);
+    }
+
+    if (!QDir{}.mkpath(QFileInfo{fileName}.absolutePath())) {
+        return false;
+    }
+    QSaveFile file{fileName};
+    if (!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    if (file.write(bytes) != bytes.size()) {
+        file.cancelWriting();
+        return false;
+    }
+    return file.commit();
+}
+
+auto load(BackupCatalog& catalog, const QString& fileName) -> bool
+{
+    QFile file{fileName};
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    const auto size = file.size();
+    const auto *data = file.map(0, size);
+    if (!data) {
+        return false;
+    }
+    const auto result = ::load(
+        catalog, std::span<const uchar>{data, static_cast<std::size_t>(size)});
+    file.unmap(const_cast<uchar*>(data)); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    return result;
+}
+
+void saveAll(const BackupCatalog& catalog)
+{
+    auto ids = QSet<QString>{};
+    for (const auto& row: catalog.destinations()) {
+        ids.insert(row.id);
+        const auto name = fileName(row.id);
+        if (!save(catalog, row.name, name)) {
+            qWarning() << "CatalogCache::saveAll unable to save" << name;
+        }
+    }
+    // Files of destinations no longer configured would otherwise stay.
+    auto dir = QDir{directory()};
+    const auto fileNames = dir.entryList({QString{"*"} + fileSuffix}, QDir::Files);
+    for (const auto& name: fileNames) {
+        if (!ids.contains(QFileInfo{name}.completeBaseName()) &&
+            !dir.remove(name)) {
+            qWarning() << "CatalogCache::saveAll unable to remove" << name;
+        }
+    }
+}
+
+auto loadAll(BackupCatalog& catalog, const QStringList& destinationIds) -> int
+{
+    auto result = 0;
+    for (const auto& id: destinationIds) {
+        const auto name = fileName(id);
+        if (!QFileInfo::exists(name)) {
+            continue;
+        }
+        if (load(catalog, name)) {
+            ++result;
+        }
+        else {
+            qWarning() << "CatalogCache::loadAll ignoring" << name;
+        }
+    }
+    return result;
+}
+
+}
@@ -0,0 +1,55 @@
+#ifndef CATALOGCACHE_H
+#define CATALOGCACHE_H
+
+#include <QString>
+#include <QStringList>
+
+#include "idset.h"
+
+class BackupCatalog;
+
+/// @brief Persistence of what's been found on each destination.
+/// @note Each destination's machines, volumes, & backups are saved to
+///   a file of their own, named for the destination's ID, under the
+///   application's data directory. Files are compact & versioned, of
+///   fixed size records that refer to a table of strings, & are read
+///   by memory mapping them. Loading a file stages its entries in the
+///   catalog like scanning does, so the tables are populated at once
+///   & later scans only signal what differs.
+namespace CatalogCache {
+
+/// @brief Version of the file format.
+/// @note Files of any other version are ignored.
+constexpr auto version = 1u;
+
+/// @brief Directory that the cache files are in.
+auto directory() -> QString;
+
+/// @brief Name of the cache file for the identified destination.
+auto fileName(const QString& destinationId) -> QString;
+
+/// @brief Saves the entries of the given destination to the named file.
+/// @return Whether the file was written.
+auto save(const BackupCatalog& catalog,
+          NameId destination,
+          const QString& fileName) -> bool;
+
+/// @brief Loads the named file into the given catalog.
+/// @return Whether the file was of this version & intact.
+auto load(BackupCatalog& catalog, const QString& fileName) -> bool;
+
+/// @brief Saves each of the catalog's destinations to its cache file.
+/// @note Cache files of destinations that the catalog doesn't have are
+///   removed, so they don't outlive the destinations being configured.
+void saveAll(const BackupCatalog& catalog);
+
+/// @brief Loads the cache file, if any, of each of the identified
+///   destinations into the given catalog.
+/// @note Only loading the files of destinations that are configured
+///   keeps what's cached of other destinations out of the catalog.
+/// @return Number of files loaded.
+auto loadAll(BackupCatalog& catalog, const QStringList& destinationIds) -> int;
+
+}
+
+#endif // CATALOGCACHE_H
@@ -0,0 +1,88 @@
+#include <cstdio> // for stdout
+#include <cstdlib> // for EXIT_FAILURE
+#include <filesystem>
+#include <memory>
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QFile>
+#include <QtDebug>
+
+#include "catalogdaemon.h"
+#include "plist_object.h"
+#include "settings.h"
+
+/// @brief Headless entry point streaming the catalog as JSON lines.
+/// @note Only a <code>QCoreApplication</code> is created, so no
+///   widgets or window system connections are ever involved.
+auto main(int argc, char *argv[]) -> int
+{
+    QCoreApplication::setOrganizationName("louis-langholtz");
+    QCoreApplication::setOrganizationDomain("louis-langholtz.github.io");
+    QCoreApplication::setApplicationName("Time Machine Helper");
+    QCoreApplication::setApplicationVersion(
+        QString("%1.%2").arg(VERSION_MAJOR).arg(VERSION_MINOR));
+
+    const QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        "Streams Time Machine destinations, machines, backups, volumes,"
+        " and status changes as JSON lines.");
+    parser.addHelpOption();
+    parser.addVersionOption();
+    const auto outputOption = QCommandLineOption{
+        {"o", "output"},
+        "Appends JSON lines to <file> instead of writing to standard output.",
+        "file"};
+    const auto maxBackupsOption = QCommandLineOption{
+        "max-backups",
+        "Keeps at most <count> backups in memory once written.",
+        "count",
+        QString::number(CatalogDaemon::defaultMaxBackups)};
+    const auto tmutilOption = QCommandLineOption{
+        "tmutil",
+        "Uses <path> as the Time Machine utility.",
+        "path",
+        Settings::tmutilPath()};
+    parser.addOptions({outputOption, maxBackupsOption, tmutilOption});
+    parser.process(app);
+
+    auto ok = false;
+    const auto maxBackups =
+        parser.value(maxBackupsOption).toULongLong(&ok);
+    if (!ok) {
+        qCritical() << "invalid max-backups value:"
+                    << parser.value(maxBackupsOption);
+        return EXIT_FAILURE;
+    }
+
+    QFile output;
+    if (parser.isSet(outputOption)) {
+        output.setFileName(parser.value(outputOption));
+        if (!output.open(QIODevice::WriteOnly|QIODevice::Append)) {
+            qCritical() << "unable to open" << output.fileName()
+                        << ":" << output.errorString();
+            return EXIT_FAILURE;
+        }
+    }
+    else if (!output.open(stdout, QIODevice::WriteOnly)) {
+        qCritical() << "unable to open standard output:"
+                    << output.errorString();
+        return EXIT_FAILURE;
+    }
+
+    // Allow some standard library types as QVariant...
+    qRegisterMetaType<std::filesystem::path>();
+    qRegisterMetaType<std::filesystem::file_status>();
+    qRegisterMetaType<std::error_code>();
+    qRegisterMetaType<std::shared_ptr<const plist_object>>();
+    qRegisterMetaType<AttributeRecord>();
+
+    CatalogDaemon daemon{&output};
+    daemon.setMaxBackups(maxBackups);
+    daemon.setTmutilPath(parser.value(tmutilOption));
+    daemon.start();
+
+    return QCoreApplication::exec();
+}
@@ -0,0 +1,485 @@
+#include <utility> // for std::exchange
+#include <variant>
+
+#include <QDateTime>
+#include <QFileDevice>
+#include <QHashFunctions>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QProcess>
+#include <QTimer>
+#include <QtDebug>
+
+#include "catalogdaemon.h"
+#include "catalogscanner.h"
+#include "plistprocess.h"
+#include "settings.h"
+
+namespace {
+
+constexpr auto tmutilStatusVerb     = "status";
+constexpr auto tmutilDestInfoVerb   = "destinationinfo";
+constexpr auto tmutilXmlOption      = "-X";
+
+constexpr auto destinationsKey = "Destinations";
+
+/// @note Toplevel key within the status plist dictionary that's only
+///   present while a backup is in progress.
+constexpr auto backupPhaseKey = "BackupPhase";
+
+/// @brief Minimum time between applying what the scanner staged.
+constexpr auto applyInterval = std::chrono::milliseconds{100};
+
+/// @brief Names that rows are tagged with, by table.
+/// @note These are under their own key, apart from the fields of rows
+///   like the kind of a destination.
+constexpr auto tableNames = std::array<const char*, 4>{
+    "destination", "machine", "volume", "backup",
+};
+
+constexpr auto tableKey = "table";
+
+auto tableName(BackupCatalog::Table table) -> const char*
+{
+    return tableNames[static_cast<std::size_t>(table)];
+}
+
+auto toJson(const std::optional<QString>& value) -> QJsonValue
+{
+    return value? QJsonValue{*value}: QJsonValue{};
+}
+
+auto toJson(const std::optional<qint64>& value) -> QJsonValue
+{
+    return value? QJsonValue{*value}: QJsonValue{};
+}
+
+auto toJson(const plist_object& object) -> QJsonValue;
+
+auto toJson(const plist_dict& dict) -> QJsonObject
+{
+    auto result = QJsonObject{};
+    for (const auto& [key, value]: dict) {
+        result.insert(QString::fromStdString(key), toJson(value));
+    }
+    return result;
+}
+
+auto toJson(const plist_object& object) -> QJsonValue
+{
+    switch (plist_element_type(object.value.index())) {
+    case plist_element_type::none:
+        break;
+    case plist_element_type::array:
+    {
+        auto result = QJsonArray{};
+        for (const auto& element: std::get<plist_array>(object.value)) {
+            result.append(toJson(element));
+        }
+        return result;
+    }
+    case plist_element_type::data:
+    {
+        const auto& data = std::get<plist_data>(object.value);
+        const auto bytes = QByteArray{data.data(), qsizetype(data.size())};
+        return QString::fromLatin1(bytes.toBase64());
+    }
+    case plist_element_type::date:
+    {
+        const auto t = std::chrono::system_clock::to_time_t(
+            std::get<plist_date>(object.value));
+        return QDateTime::fromSecsSinceEpoch(t).toUTC()
+            .toString(Qt::ISODate);
+    }
+    case plist_element_type::dict:
+        return toJson(std::get<plist_dict>(object.value));
+    case plist_element_type::real:
+        return std::get<plist_real>(object.value);
+    case plist_element_type::integer:
+        return qint64(std::get<plist_integer>(object.value));
+    case plist_element_type::string:
+        return QString::fromStdString(std::get<plist_string>(object.value));
+    case plist_element_type::so_true:
+        return true;
+    case plist_element_type::so_false:
+        return false;
+    case plist_element_type::key:
+    case plist_element_type::plist:
+        break;
+    }
+    return {};
+}
+
+auto toJson(const std::optional<std::chrono::microseconds>& value)
+    -> QJsonValue
+{
+    if (!value) {
+        return {};
+    }
+    using namespace std::chrono;
+    const auto msecs = duration_cast<milliseconds>(*value).count();
+    return QDateTime::fromMSecsSinceEpoch(msecs).toUTC()
+        .toString(Qt::ISODateWithMs);
+}
+
+auto toJson(const IdSet& ids, const StringInterner& names) -> QJsonArray
+{
+    auto result = QJsonArray{};
+    ids.forEach([&](NameId id){
+        result.append(names.string(id));
+    });
+    return result;
+}
+
+}
+
+CatalogDaemon::CatalogDaemon(QFileDevice *output, QObject *parent):
+    QObject{parent},
+    output{output},
+    catalog{new BackupCatalog{this}},
+    scheduler{new JobScheduler{this}},
+    scanner{new CatalogScanner{this->catalog, this->scheduler, this}},
+    applyTimer{new QTimer{this}},
+    tmutil{Settings::tmutilPath()},
+    lastStatus{std::make_shared<const plist_dict>()},
+    statusPollPolicy{
+        std::chrono::milliseconds{Settings::defaultTmutilStatInterval()}}
+{
+    this->applyTimer->setSingleShot(true);
+    this->applyTimer->setInterval(applyInterval);
+    connect(this->applyTimer, &QTimer::timeout,
+            this, &CatalogDaemon::applyPending);
+    connect(this->scanner, &CatalogScanner::staged,
+            this, &CatalogDaemon::scheduleApply);
+    connect(this->scanner, &CatalogScanner::readFailed,
+            this, &CatalogDaemon::handleReadFailed);
+    connect(this->catalog, &BackupCatalog::inserted,
+            this, &CatalogDaemon::handleInserted);
+    connect(this->catalog, &BackupCatalog::changed,
+            this, &CatalogDaemon::handleChanged);
+    connect(this->catalog, &BackupCatalog::aboutToRemove,
+            this, &CatalogDaemon::handleAboutToRemove);
+}
+
+CatalogDaemon::~CatalogDaemon() = default;
+
+auto CatalogDaemon::maxBackups() const noexcept -> std::size_t
+{
+    return this->maxBackupCount;
+}
+
+void CatalogDaemon::setMaxBackups(std::size_t value)
+{
+    this->maxBackupCount = value;
+}
+
+auto CatalogDaemon::tmutilPath() const -> QString
+{
+    return this->tmutil;
+}
+
+void CatalogDaemon::setTmutilPath(const QString &path)
+{
+    this->tmutil = path;
+}
+
+void CatalogDaemon::start()
+{
+    this->scheduler->setSlack(
+        std::chrono::milliseconds{Settings::schedulerSlack()});
+    this->scanner->setScanInterval(
+        std::chrono::milliseconds{Settings::pathInfoInterval()});
+    this->scanner->setGenerations(
+        static_cast<unsigned>(Settings::pathInfoGenerations()));
+    this->statusPollPolicy.setIdleInterval(
+        std::chrono::milliseconds{Settings::tmutilStatInterval()});
+    // Each status poll schedules the next, per the status poll policy.
+    this->statusJob = this->scheduler->add(
+        "status", this->statusPollPolicy.interval(), [this](){
+        this->checkTmStatus();
+        return true;
+    });
+    this->destinationsJob = this->scheduler->add(
+        "destinations",
+        std::chrono::milliseconds{Settings::tmutilDestInterval()},
+        [this](){
+        this->checkTmDestinations();
+        return true;
+    });
+}
+
+void CatalogDaemon::checkTmDestinations()
+{
+    auto *process = new PlistProcess{this};
+    connect(process, &PlistProcess::gotPlist,
+            this, &CatalogDaemon::handleTmDestinations);
+    connect(process, &PlistProcess::errorOccurred,
+            this, &CatalogDaemon::handleProcessError);
+    connect(process, &PlistProcess::errorOccurred,
+            this, [this,process](int error, const QString&){
+        if (QProcess::ProcessError(error) != QProcess::FailedToStart) {
+            return;
+        }
+        // No finished signal follows.
+        this->scheduler->finished(this->destinationsJob);
+        process->deleteLater();
+    });
+    connect(process, &PlistProcess::gotReaderError,
+            this, &CatalogDaemon::handleReaderError);
+    connect(process, &PlistProcess::finished,
+            this, [this](){
+        this->scheduler->finished(this->destinationsJob);
+    });
+    connect(process, &PlistProcess::finished,
+            process, &PlistProcess::deleteLater);
+    process->start(this->tmutil,
+                   QStringList() << tmutilDestInfoVerb
+                                 << tmutilXmlOption);
+}
+
+void CatalogDaemon::checkTmStatus()
+{
+    auto *process = new PlistProcess{this};
+    connect(process, &PlistProcess::gotPlist,
+            this, &CatalogDaemon::handleTmStatus);
+    connect(process, &PlistProcess::errorOccurred,
+            this, &CatalogDaemon::handleProcessError);
+    connect(process, &PlistProcess::errorOccurred,
+            this, [this,process](int error, const QString&){
+        if (QProcess::ProcessError(error) != QProcess::FailedToStart) {
+            return;
+        }
+        // No finished signal follows, so schedule the next poll here.
+        this->scheduler->finished(this->statusJob);
+        this->statusPollFailed = false;
+        this->scheduler->runIn(this->statusJob,
+                               this->statusPollPolicy.failed());
+        process->deleteLater();
+    });
+    connect(process, &PlistProcess::gotReaderError,
+            this, [this](qint64 lineNumber, int error, const QString& text){
+        this->statusPollFailed = true;
+        this->handleReaderError(lineNumber, error, text);
+    });
+    connect(process, &PlistProcess::finished,
+            this, [this](const QString&, const QStringList&,
+                         int code, int status){
+        this->scheduler->finished(this->statusJob);
+        // Counted once however many ways the poll failed.
+        const auto failed = std::exchange(this->statusPollFailed, false);
+        if (failed ||
+            (QProcess::ExitStatus(status) != QProcess::NormalExit) ||
+            (code != 0)) {
+            (void) this->statusPollPolicy.failed();
+        }
+        this->scheduler->runIn(this->statusJob,
+                               this->statusPollPolicy.interval());
+    });
+    connect(process, &PlistProcess::finished,
+            process, &PlistProcess::deleteLater);
+    process->start(this->tmutil,
+                   QStringList() << tmutilStatusVerb
+                                 << tmutilXmlOption);
+}
+
+void CatalogDaemon::handleTmDestinations(
+    const plist_ptr<plist_object>& plist)
+{
+    const auto dict = get_ptr<plist_dict>(plist);
+    const auto array = get_ptr<plist_array>(dict, destinationsKey);
+    if (!array) {
+        qWarning() << "CatalogDaemon: unexpected destinations plist!";
+        return;
+    }
+    auto destinations = std::vector<plist_ptr<plist_dict>>{};
+    destinations.reserve(array->size());
+    for (const auto& element: *array) {
+        if (const auto p = std::get_if<plist_dict>(&element.value)) {
+            // Shares ownership of the whole document instead of copying.
+            destinations.emplace_back(array, p);
+        }
+    }
+    this->scanner->setDestinations(destinations);
+}
+
+void CatalogDaemon::handleTmStatus(const plist_ptr<plist_object>& plist)
+{
+    const auto dict = get_ptr<plist_dict>(plist);
+    if (!dict) {
+        this->statusPollFailed = true;
+        return;
+    }
+    (void) this->statusPollPolicy.polled(
+        get<plist_string>(*dict, backupPhaseKey).has_value());
+    if (*dict == *(this->lastStatus)) {
+        return;
+    }
+    this->lastStatus = dict;
+    this->write("status", QJsonObject{
+        {"status", ::toJson(*plist)},
+    });
+}
+
+void CatalogDaemon::handleProcessError(int error, const QString &text)
+{
+    this->write("error", QJsonObject{
+        {"program", this->tmutil},
+        {"processError", error},
+        {"message", text},
+    });
+}
+
+void CatalogDaemon::handleReaderError(qint64 lineNumber, int error,
+                                      const QString &text)
+{
+    this->write("error", QJsonObject{
+        {"program", this->tmutil},
+        {"line", lineNumber},
+        {"readerError", error},
+        {"message", text},
+    });
+}
+
+void CatalogDaemon::handleReadFailed(const std::filesystem::path &dir,
+                                     std::error_code ec)
+{
+    this->write("error", QJsonObject{
+        {"path", QString::fromStdString(dir.string())},
+        {"message", QString::fromStdString(ec.message())},
+    });
+}
+
+void CatalogDaemon::handleInserted(BackupCatalog::Table table,
+                                   int first, int last)
+{
+    auto& hashes = this->written[static_cast<std::size_t>(table)];
+    hashes.insert(hashes.begin() + first,
+                  std::size_t(last - first + 1), std::size_t{});
+    this->writeRows(table, first, last);
+}
+
+void CatalogDaemon::handleChanged(BackupCatalog::Table table,
+                                  int first, int last)
+{
+    this->writeRows(table, first, last);
+}
+
+void CatalogDaemon::handleAboutToRemove(BackupCatalog::Table table,
+                                        int first, int last)
+{
+    for (auto row = first; !this->evicting && (row <= last); ++row) {
+        this->write("removed", this->toJson(table, row));
+    }
+    auto& hashes = this->written[static_cast<std::size_t>(table)];
+    hashes.erase(hashes.begin() + first, hashes.begin() + last + 1);
+}
+
+void CatalogDaemon::scheduleApply()
+{
+    if (!this->applyTimer->isActive()) {
+        this->applyTimer->start();
+    }
+}
+
+void CatalogDaemon::applyPending()
+{
+    this->catalog->applyPending();
+    // Rows are written as they're applied, so they can be evicted now.
+    this->evicting = true;
+    this->scanner->evictSealedBackups(this->maxBackupCount);
+    this->evicting = false;
+}
+
+void CatalogDaemon::writeRows(BackupCatalog::Table table,
+                              int first, int last)
+{
+    auto& hashes = this->written[static_cast<std::size_t>(table)];
+    for (auto row = first; row <= last; ++row) {
+        const auto object = this->toJson(table, row);
+        const auto value = qHash(
+            QJsonDocument{object}.toJson(QJsonDocument::Compact));
+        if (std::exchange(hashes[std::size_t(row)], value) != value) {
+            this->write(tableName(table), object);
+        }
+    }
+}
+
+auto CatalogDaemon::toJson(BackupCatalog::Table table, int row) const
+    -> QJsonObject
+{
+    const auto& names = this->catalog->names();
+    const auto index = std::size_t(row);
+    auto result = QJsonObject{};
+    switch (table) {
+    case BackupCatalog::Table::Destinations:
+    {
+        const auto& entry = this->catalog->destinations()[index];
+        result = QJsonObject{
+            {"id", entry.id},
+            {"name", names.destinations.string(entry.name)},
+            {"kind", entry.kind},
+            {"mountPoint", entry.mountPoint},
+        };
+        break;
+    }
+    case BackupCatalog::Table::Machines:
+    {
+        const auto& entry = this->catalog->machines()[index];
+        result = QJsonObject{
+            {"name", names.machines.string(entry.name)},
+            {"uuid", entry.uuid},
+            {"model", entry.model},
+            {"address", entry.address},
+            {"destinations", ::toJson(entry.destinations, names.destinations)},
+        };
+        break;
+    }
+    case BackupCatalog::Table::Volumes:
+    {
+        const auto& entry = this->catalog->volumes()[index];
+        result = QJsonObject{
+            {"name", names.volumes.string(entry.name)},
+            {"uuid", entry.uuid},
+            {"fsType", entry.type},
+            {"path", entry.path},
+            {"bytesUsed", entry.maxUsed},
+            {"machines", ::toJson(entry.machines, names.machines)},
+            {"destinations", ::toJson(entry.destinations, names.destinations)},
+        };
+        break;
+    }
+    case BackupCatalog::Table::Backups:
+    {
+        const auto& entry = this->catalog->backups()[index];
+        result = QJsonObject{
+            {"destination", names.destinations.string(entry.key.destination)},
+            {"machine", names.machines.string(entry.key.machine)},
+            {"name", names.backups.string(entry.key.name)},
+            {"path", entry.path},
+            {"snapshotType", entry.type},
+            {"state", entry.state},
+            {"version", ::toJson(entry.version)},
+            {"number", ::toJson(entry.number)},
+            {"start", ::toJson(entry.started)},
+            {"finish", ::toJson(entry.finished)},
+            {"bytesCopied", ::toJson(entry.size)},
+            {"sealed", entry.sealed},
+            {"volumes", ::toJson(entry.volumes, names.volumes)},
+        };
+        break;
+    }
+    }
+    result.insert(tableKey, tableName(table));
+    return result;
+}
+
+void CatalogDaemon::write(const char *type, QJsonObject object)
+{
+    object.insert("type", type);
+    object.insert("time", QDateTime::currentDateTimeUtc()
+                              .toString(Qt::ISODateWithMs));
+    auto line = QJsonDocument{object}.toJson(QJsonDocument::Compact);
+    line.append('\n');
+    this->output->write(line);
+    this->output->flush();
+}
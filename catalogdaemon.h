@@ -0,0 +1,112 @@
+#ifndef CATALOGDAEMON_H
+#define CATALOGDAEMON_H
+
+#include <array>
+#include <cstddef> // for std::size_t
+#include <filesystem>
+#include <system_error>
+#include <vector>
+
+#include <QJsonObject>
+#include <QObject>
+#include <QString>
+
+#include "backupcatalog.h"
+#include "jobscheduler.h"
+#include "plist_object.h"
+#include "statuspollpolicy.h"
+
+class QFileDevice;
+class QTimer;
+
+class CatalogScanner;
+
+/// @brief Headless cataloger of Time Machine destinations & backups.
+/// @note This drives the same catalog scanner as the main window, on
+///   the same kind of job scheduler, polling <code>tmutil</code> for
+///   destinations & status, but streams the changes that the catalog
+///   signals as JSON lines to an output device instead of showing them.
+///   No widgets are involved. Only a hash per catalog row is kept
+///   beyond the catalog, so rows signaled as changed are only written
+///   again if what's written of them differs. Memory stays bounded by
+///   evicting the oldest sealed backups beyond a maximum once written.
+class CatalogDaemon : public QObject
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    /// @brief Default number of backups kept once written.
+    static constexpr auto defaultMaxBackups = std::size_t{10000};
+
+    explicit CatalogDaemon(QFileDevice *output,
+                           QObject *parent = nullptr);
+    ~CatalogDaemon() override;
+
+    [[nodiscard]] auto maxBackups() const noexcept -> std::size_t;
+
+    /// @brief Sets the maximum number of backups kept in the catalog.
+    /// @note Beyond this, the oldest sealed backups are evicted once
+    ///   written, without writing their removal, to bound memory use.
+    void setMaxBackups(std::size_t value);
+
+    [[nodiscard]] auto tmutilPath() const -> QString;
+    void setTmutilPath(const QString& path);
+
+    /// @brief Starts polling & scanning at the configured intervals.
+    void start();
+
+private:
+    void checkTmDestinations();
+    void checkTmStatus();
+    void handleTmDestinations(const plist_ptr<plist_object>& plist);
+    void handleTmStatus(const plist_ptr<plist_object>& plist);
+    void handleProcessError(int error, const QString& text);
+    void handleReaderError(qint64 lineNumber, int error,
+                           const QString& text);
+    void handleReadFailed(const std::filesystem::path& dir,
+                          std::error_code ec);
+
+    void handleInserted(BackupCatalog::Table table, int first, int last);
+    void handleChanged(BackupCatalog::Table table, int first, int last);
+    void handleAboutToRemove(BackupCatalog::Table table, int first, int last);
+
+    /// @brief Schedules applying what the scanner staged in the catalog.
+    void scheduleApply();
+
+    /// @brief Applies what the scanner staged in the catalog, then
+    ///   evicts backups beyond the maximum.
+    void applyPending();
+
+    /// @brief Writes the given rows of the table that differ from what
+    ///   was last written of them.
+    void writeRows(BackupCatalog::Table table, int first, int last);
+
+    /// @brief JSON of the given row, tagged with its table.
+    [[nodiscard]] auto toJson(BackupCatalog::Table table, int row) const
+        -> QJsonObject;
+    void write(const char *type, QJsonObject object);
+
+    QFileDevice *output{};
+    BackupCatalog *catalog{};
+    JobScheduler *scheduler{};
+    CatalogScanner *scanner{};
+    QTimer *applyTimer{};
+    JobScheduler::JobId destinationsJob{};
+    JobScheduler::JobId statusJob{};
+    QString tmutil;
+    std::size_t maxBackupCount{defaultMaxBackups};
+    /// @brief Whether rows being removed are evicted rather than gone.
+    bool evicting{};
+    plist_ptr<plist_dict> lastStatus;
+    StatusPollPolicy statusPollPolicy;
+    /// @brief Whether the output of the status poll in flight couldn't
+    ///   be used, so the poll's counted as failed when it finishes.
+    bool statusPollFailed{};
+
+    /// @brief Hashes of what was last written of each row, per table.
+    std::array<std::vector<std::size_t>, 4> written;
+};
+
+#endif // CATALOGDAEMON_H
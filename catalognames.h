@@ -0,0 +1,17 @@
+#ifndef CATALOGNAMES_H
+#define CATALOGNAMES_H
+
+#include "stringinterner.h"
+
+/// @brief Interned names of the things found in Time Machine destinations.
+/// @note Each kind of name has its own identifier space, so that sets
+///   of each kind stay dense.
+struct CatalogNames
+{
+    StringInterner destinations;
+    StringInterner machines;
+    StringInterner backups;
+    StringInterner volumes;
+};
+
+#endif // CATALOGNAMES_H
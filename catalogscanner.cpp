@@ -0,0 +1,606 @@
+#include <algorithm> // for std::max, std::min, std::mismatch
+#include <utility> // for std::as_const, std::exchange
+#include <variant>
+
+#include <QThread>
+#include <QThreadPool>
+#include <QtDebug>
+
+#include "backupcatalog.h"
+#include "catalogscanner.h"
+
+namespace {
+
+/// @brief Most doublings of a destination's scan interval while it's
+///   not changing.
+constexpr auto maxQuietScanDoublings = 3;
+
+/// @brief Minimum time between reconciling the deletions of backups
+///   from a listing of their machine directory.
+/// @note In between, machine directories having unchanged stamps only
+///   have their tails read.
+constexpr auto machineDirReconcileInterval = std::chrono::minutes{10};
+
+/// @brief Most directory reading threads.
+constexpr auto maxReaderThreads = 4;
+
+auto isWithin(const std::filesystem::path& path,
+              const std::filesystem::path& dir) -> bool
+{
+    const auto result = std::mismatch(dir.begin(), dir.end(),
+                                      path.begin(), path.end());
+    return result.first == dir.end();
+}
+
+/// @brief Whether the given infos are of the same status & record.
+/// @note Their locations aren't compared, as they follow from the path.
+auto isSame(const PathInfo& lhs, const PathInfo& rhs) -> bool
+{
+    return (lhs.status.permissions() == rhs.status.permissions()) &&
+           (lhs.status.type() == rhs.status.type()) &&
+           (lhs.record == rhs.record);
+}
+
+auto nameOf(const plist_dict &destination) -> QString
+{
+    return QString::fromStdString(
+        get<std::string>(destination, "Name").value_or(""));
+}
+
+}
+
+CatalogScanner::CatalogScanner(BackupCatalog *catalog,
+                               JobScheduler *scheduler,
+                               QObject *parent):
+    QObject{parent},
+    catalog{catalog},
+    scheduler{scheduler},
+    readerPool{new QThreadPool{this}}
+{
+    this->readerPool->setMaxThreadCount(
+        std::min(QThread::idealThreadCount(), maxReaderThreads));
+    // Each sweep starts a new scan pass.
+    this->sweepJob = this->scheduler->add(
+        "sweep", this->interval, [this](){
+        this->sweep();
+        ++(this->pathGeneration);
+        return false;
+    }, this->interval);
+}
+
+CatalogScanner::~CatalogScanner()
+{
+    // The scheduler may have been destroyed first, as a sibling.
+    if (!this->scheduler) {
+        return;
+    }
+    this->scheduler->remove(this->sweepJob);
+    for (const auto& entry: this->scans) {
+        this->scheduler->remove(entry.second.job);
+    }
+}
+
+auto CatalogScanner::mountPoints() const noexcept
+    -> const std::map<std::string, plist_ptr<plist_dict>>&
+{
+    return this->mountMap;
+}
+
+auto CatalogScanner::scanInterval() const noexcept
+    -> std::chrono::milliseconds
+{
+    return this->interval;
+}
+
+auto CatalogScanner::generations() const noexcept -> unsigned
+{
+    return this->generationCount;
+}
+
+void CatalogScanner::setDestinations(
+    const std::vector<plist_ptr<plist_dict>>& destinations)
+{
+    auto& names = this->catalog->names();
+    auto catalogDestinations = std::vector<BackupCatalog::Destination>{};
+    catalogDestinations.reserve(destinations.size());
+    auto mountPoints = std::map<std::string, plist_ptr<plist_dict>>{};
+    for (const auto& destinationPtr: destinations) {
+        const auto& destination = *destinationPtr;
+        const auto mp = get<std::string>(destination, "MountPoint");
+        catalogDestinations.push_back({
+            .id = QString::fromStdString(
+                get<std::string>(destination, "ID").value_or("")),
+            .name = names.destinations.intern(nameOf(destination)),
+            .kind = QString::fromStdString(
+                get<std::string>(destination, "Kind").value_or("")),
+            .mountPoint = QString::fromStdString(mp.value_or("")),
+        });
+        if (mp) {
+            mountPoints.emplace(*mp, destinationPtr);
+        }
+    }
+    this->catalog->setDestinations(std::move(catalogDestinations));
+    for (const auto& mountPoint: this->mountMap) {
+        if (mountPoints.contains(mountPoint.first)) {
+            continue;
+        }
+        // Drop everything read from the destination no longer mounted.
+        if (const auto node = this->pathTrie.find(mountPoint.first)) {
+            this->pathTrie.erase(*node);
+        }
+    }
+    this->mountMap = std::move(mountPoints);
+    this->updateScanJobs();
+}
+
+void CatalogScanner::setScanInterval(std::chrono::milliseconds value)
+{
+    this->interval = value;
+    for (const auto& entry: this->scans) {
+        this->scheduler->setInterval(entry.second.job,
+                                     this->intervalOf(entry.second));
+    }
+    this->updateSweepInterval();
+}
+
+void CatalogScanner::setGenerations(unsigned value)
+{
+    this->generationCount = std::max(value, 1u);
+}
+
+void CatalogScanner::setScanEnabled(const std::string& mountPoint, bool value)
+{
+    const auto it = this->scans.find(mountPoint);
+    if (it != this->scans.end()) {
+        this->scheduler->setEnabled(it->second.job, value);
+    }
+}
+
+void CatalogScanner::prioritizeRead(const std::string& pathName)
+{
+    const auto node = this->pathTrie.find(pathName);
+    auto *reader = node? this->pathTrie.value(*node).reader: nullptr;
+    if (!reader) {
+        return;
+    }
+    // Only a reader still queued can be taken back & requeued.
+    if (this->readerPool->tryTake(reader)) {
+        this->readerPool->start(reader, demandReadPriority);
+    }
+}
+
+void CatalogScanner::evictSealedBackups(std::size_t keep)
+{
+    for (const auto& path: this->catalog->evictSealedBackups(keep)) {
+        if (const auto node = this->pathTrie.find(path.toStdString())) {
+            this->pathTrie.erase(*node);
+        }
+    }
+}
+
+void CatalogScanner::updateScanJobs()
+{
+    for (auto it = this->scans.begin(); it != this->scans.end();) {
+        if (this->mountMap.contains(it->first)) {
+            ++it;
+            continue;
+        }
+        this->scheduler->remove(it->second.job);
+        it = this->scans.erase(it);
+    }
+    auto jobs = std::vector<JobScheduler::JobId>{};
+    for (const auto& entry: this->scans) {
+        jobs.push_back(entry.second.job);
+    }
+    for (const auto& mountPoint: this->mountMap) {
+        const auto& mp = mountPoint.first;
+        if (this->scans.contains(mp)) {
+            continue;
+        }
+        auto& scan = this->scans[mp];
+        const auto scanInterval = this->intervalOf(scan);
+        // Scans are in flight till every reader they lead to has ended.
+        scan.job = this->scheduler->add(
+            QString("scan %1").arg(QString::fromStdString(mp)),
+            scanInterval, [this,mp](){
+            const auto it = this->scans.find(mp);
+            if (it == this->scans.end()) {
+                return false;
+            }
+            it->second.changes = 0;
+            this->read(mp);
+            return it->second.readers > 0;
+        }, this->scheduler->staggeredDelay(jobs, scanInterval));
+        jobs.push_back(scan.job);
+    }
+}
+
+auto CatalogScanner::intervalOf(const DestinationScan& scan) const
+    -> std::chrono::milliseconds
+{
+    const auto doublings = std::min(scan.quietScans, maxQuietScanDoublings);
+    return this->interval * (1 << doublings);
+}
+
+void CatalogScanner::scanEnded(DestinationScan& scan)
+{
+    this->scheduler->finished(scan.job);
+    scan.quietScans = (scan.changes > 0)
+        ? 0
+        : std::min(scan.quietScans + 1, maxQuietScanDoublings);
+    this->scheduler->setInterval(scan.job, this->intervalOf(scan));
+    this->updateSweepInterval();
+}
+
+void CatalogScanner::updateSweepInterval()
+{
+    auto result = this->interval;
+    for (const auto& entry: this->scans) {
+        result = std::max(result, this->intervalOf(entry.second));
+    }
+    this->scheduler->setInterval(this->sweepJob, result);
+}
+
+auto CatalogScanner::mountPointOf(const std::filesystem::path& path) const
+    -> std::optional<std::string>
+{
+    for (const auto& entry: this->scans) {
+        if (isWithin(path, entry.first)) {
+            return entry.first;
+        }
+    }
+    return {};
+}
+
+void CatalogScanner::read(const std::string& pathName, int priority)
+{
+    const auto node = this->pathTrie.insert(pathName);
+    this->pathTrie.value(node).generation = this->pathGeneration;
+    if (this->pathTrie.value(node).reader) {
+        qDebug() << "blocking reader for" << pathName;
+        return;
+    }
+    auto *reader = new DirectoryReader(pathName);
+    reader->setAutoDelete(true);
+    this->pathTrie.value(node).reader = reader;
+    const auto mountPoint = this->mountPointOf(pathName);
+    if (mountPoint) {
+        ++(this->scans[*mountPoint].readers);
+    }
+    this->setUpMachineDirReader(*reader, pathName);
+    connect(reader, &DirectoryReader::entry,
+            this, &CatalogScanner::handleEntry);
+    connect(reader, &DirectoryReader::ended,
+            this, &CatalogScanner::handleEnded);
+    connect(reader, &DirectoryReader::destroyed,
+            this, [this,node,reader,mountPoint](QObject *){
+        // The node may have been dropped, & its handle reused, since.
+        if (this->pathTrie.contains(node) &&
+            (this->pathTrie.value(node).reader == reader)) {
+            this->pathTrie.value(node).reader = nullptr;
+        }
+        // As may the destination.
+        const auto it = mountPoint
+            ? this->scans.find(*mountPoint)
+            : this->scans.end();
+        if ((it != this->scans.end()) &&
+            (it->second.readers > 0) && (--(it->second.readers) == 0)) {
+            this->scanEnded(it->second);
+        }
+    });
+    connect(this, &CatalogScanner::destroyed,
+            reader, &DirectoryReader::requestInterruption);
+    this->readerPool->start(reader, priority);
+}
+
+void CatalogScanner::sweep()
+{
+    const auto current = this->pathGeneration;
+    const auto generations = this->generationCount;
+    const auto nodesBefore = this->pathTrie.size();
+    const auto bytesBefore = this->pathTrie.bytesUsed();
+    const auto dropped = this->pathTrie.prune([=](const PathNode& node){
+        return !node.reader && ((current - node.generation) >= generations);
+    });
+    qDebug() << "CatalogScanner::sweep dropped" << dropped
+             << "nodes; nodes before & after:" << nodesBefore
+             << this->pathTrie.size()
+             << "; bytes before & after:" << bytesBefore
+             << this->pathTrie.bytesUsed();
+}
+
+void CatalogScanner::handleEntry(
+    const std::filesystem::path& path,
+    const std::filesystem::file_status& status,
+    const AttributeRecord& record)
+{
+    auto pathInfo = PathInfo{status, record};
+    const auto node = this->pathTrie.insert(path);
+    this->pathTrie.value(node).generation = this->pathGeneration;
+    auto& info = this->pathTrie.value(node).info;
+    const auto changed = !info || !isSame(*info, pathInfo);
+    if (changed) {
+        if (const auto mountPoint = this->mountPointOf(path)) {
+            ++(this->scans[*mountPoint].changes);
+        }
+    }
+    if (info) {
+        pathInfo.location = std::move(info->location);
+    }
+    info = std::move(pathInfo);
+    auto& entry = *info;
+
+    if (std::holds_alternative<StorageDirRecord>(record)) {
+        // This is the "Backups.backupdb" like directory, just go deeper...
+        if (!entry.location) {
+            entry.location = this->childLocation(path);
+        }
+        this->read(path);
+        return;
+    }
+
+    if (std::holds_alternative<std::monostate>(record)) {
+        return;
+    }
+    if (!entry.location) {
+        entry.location = this->childLocation(path);
+        if (!entry.location) {
+            qWarning() << "CatalogScanner::handleEntry no location for"
+                       << path;
+            return;
+        }
+    }
+    const auto& location = *entry.location;
+
+    if (const auto machine = std::get_if<MachineRecord>(&record)) {
+        this->updateMachine(location, *machine);
+        this->read(path);
+        return;
+    }
+
+    if (const auto backup = std::get_if<BackupRecord>(&record)) {
+        if (changed) {
+            this->updateBackup(path, location, *backup);
+        }
+        // Volumes are read lazily unless none have been read from this
+        // machine directory yet.
+        auto& scan = this->machineDirScans[path.parent_path()];
+        const auto demanded = !std::exchange(scan.volumesDemanded, true);
+        this->read(path, demanded? demandReadPriority: fillerReadPriority);
+        return;
+    }
+
+    if (const auto volume = std::get_if<VolumeRecord>(&record)) {
+        if (changed) {
+            this->updateVolume(path, location, *volume);
+        }
+    }
+}
+
+void CatalogScanner::handleEnded(
+    const std::filesystem::path& dir,
+    std::error_code ec,
+    const QSet<QString>& filenames)
+{
+    if (ec) {
+        qDebug() << "CatalogScanner::handleEnded called for"
+                 << dir << ":" << ec.message();
+        emit readFailed(dir, ec);
+        return;
+    }
+    this->reportDir(dir, filenames);
+}
+
+void CatalogScanner::reportDir(
+    const std::filesystem::path& dir,
+    const QSet<QString>& filenames)
+{
+    const auto node = this->pathTrie.find(dir);
+    if (!node || !this->pathTrie.value(*node).info) {
+        return;
+    }
+    const auto& info = *(this->pathTrie.value(*node).info);
+    const auto location = info.location;
+    if (!location) {
+        return;
+    }
+    if (std::holds_alternative<MachineRecord>(info.record)) {
+        this->updateMachineDir(dir, *location, filenames);
+        return;
+    }
+    if (std::holds_alternative<BackupRecord>(info.record)) {
+        this->updateVolumeDir(*location, filenames);
+        return;
+    }
+}
+
+void CatalogScanner::updateMachine(
+    const BackupLocation& location,
+    const MachineRecord& record)
+{
+    if (location.level != BackupLocation::Level::Machine) {
+        qWarning() << "CatalogScanner::updateMachine not a machine location?";
+        return;
+    }
+    this->catalog->updateMachine(location.machine,
+                                 record.uuid.value_or(QString{}),
+                                 record.model.value_or(QString{}),
+                                 record.address.value_or(QString{}),
+                                 location.destination);
+    emit staged();
+}
+
+void CatalogScanner::updateBackup(const std::filesystem::path& path,
+                                  const BackupLocation& location,
+                                  const BackupRecord& record)
+{
+    if (location.level != BackupLocation::Level::Backup) {
+        qWarning() << "CatalogScanner::updateBackup not a backup location?";
+        return;
+    }
+    this->catalog->stageBackup({
+        .key = {
+            .destination = location.destination,
+            .machine = location.machine,
+            .name = location.backup,
+        },
+        .path = QString::fromStdString(path),
+        .type = record.type.value_or(QString{}),
+        .state = record.state.value_or(QString{}),
+        .version = record.version,
+        .number = record.number,
+        .started = record.started,
+        .finished = record.finished,
+        .size = record.bytesCopied,
+        .sealed = record.sealed(),
+    });
+    emit staged();
+}
+
+void CatalogScanner::updateVolume(const std::filesystem::path& path,
+                                  const BackupLocation& location,
+                                  const VolumeRecord& record)
+{
+    if (location.level != BackupLocation::Level::Volume) {
+        qWarning() << "CatalogScanner::updateVolume not a volume location?";
+        return;
+    }
+    this->catalog->stageVolume(QString::fromStdString(path),
+                               location.volume,
+                               record.uuid.value_or(QString{}),
+                               record.fileSystemType.value_or(QString{}),
+                               record.bytesUsed,
+                               location.machine,
+                               location.destination,
+                               location.backup);
+    this->catalog->insertMachineVolume(location.machine, location.volume);
+    emit staged();
+}
+
+void CatalogScanner::updateMachineDir(const std::filesystem::path& dir,
+                                      const BackupLocation& location,
+                                      const QSet<QString>& filenames)
+{
+    auto& names = this->catalog->names();
+    auto& scan = this->machineDirScans[dir];
+    auto found = IdSet{};
+    if (scan.listed) {
+        scan.reconciled = std::chrono::steady_clock::now();
+    }
+    else {
+        // Only the tail was read, so keep what's known of the rest.
+        found = scan.backups;
+        for (const auto& name: std::as_const(scan.tailNames)) {
+            found.assign(names.backups.intern(name), false);
+        }
+    }
+    for (const auto& filename: filenames) {
+        found.set(names.backups.intern(filename));
+    }
+    scan.backups = found;
+    // Backups only listed, or not read at all, are still seen.
+    found.forEach([&](NameId id){
+        const auto path = dir / names.backups.string(id).toStdString();
+        if (const auto node = this->pathTrie.find(path)) {
+            this->pathTrie.value(*node).generation = this->pathGeneration;
+        }
+    });
+    const auto deleted = this->catalog->setMachineBackups(
+        location.destination, location.machine, found);
+    if (!deleted.empty()) {
+        qDebug() << "CatalogScanner::updateMachineDir deleted"
+                 << deleted.count();
+        deleted.forEach([&](NameId id){
+            const auto path = dir / names.backups.string(id).toStdString();
+            if (const auto node = this->pathTrie.find(path)) {
+                this->pathTrie.erase(*node);
+            }
+        });
+    }
+}
+
+void CatalogScanner::updateVolumeDir(const BackupLocation& location,
+                                     const QSet<QString>& filenames)
+{
+    auto& names = this->catalog->names();
+    auto volumes = IdSet{};
+    for (const auto& filename: filenames) {
+        volumes.set(names.volumes.intern(filename));
+    }
+    this->catalog->stageBackupVolumes({
+        .destination = location.destination,
+        .machine = location.machine,
+        .name = location.backup,
+    }, std::move(volumes));
+    emit staged();
+}
+
+void CatalogScanner::setUpMachineDirReader(DirectoryReader& reader,
+                                           const std::filesystem::path& dir)
+{
+    const auto node = this->pathTrie.find(dir);
+    if (!node) {
+        return;
+    }
+    const auto& info = this->pathTrie.value(*node).info;
+    if (!info || !info->location ||
+        (info->location->level != BackupLocation::Level::Machine)) {
+        return;
+    }
+    const auto location = *(info->location);
+    const auto& names = this->catalog->names();
+    const auto sealed = this->catalog->sealedBackups(location.destination,
+                                                     location.machine);
+    auto sealedNames = QSet<QString>{};
+    sealed.forEach([&](NameId id){
+        sealedNames.insert(names.backups.string(id));
+    });
+    reader.setListOnlyNames(std::move(sealedNames));
+
+    auto& scan = this->machineDirScans[dir];
+    scan.listed = true; // unless the reader signals otherwise
+    scan.tailNames.clear();
+    scan.backups.forEach([&](NameId id){
+        if (!sealed.test(id)) {
+            scan.tailNames.insert(names.backups.string(id));
+        }
+    });
+    const auto reconcileDue =
+        (std::chrono::steady_clock::now() - scan.reconciled) >=
+        machineDirReconcileInterval;
+    reader.setTail(reconcileDue? std::nullopt: scan.stamp, scan.tailNames);
+    connect(&reader, &DirectoryReader::stamped,
+            this, [this](const std::filesystem::path& dir,
+                         const DirectoryStamp& stamp,
+                         bool listed){
+        auto& scan = this->machineDirScans[dir];
+        scan.stamp = stamp;
+        scan.listed = listed;
+    });
+}
+
+auto CatalogScanner::childLocation(const std::filesystem::path& path)
+    -> std::optional<BackupLocation>
+{
+    auto& names = this->catalog->names();
+    const auto dir = path.parent_path();
+    const auto filename = QString::fromStdString(path.filename().string());
+    if (const auto node = this->pathTrie.find(dir)) {
+        // Mount points are read, so have nodes, but have no info.
+        const auto& info = this->pathTrie.value(*node).info;
+        if (info && info->location) {
+            return info->location->child(filename, names);
+        }
+    }
+    const auto it = this->mountMap.find(dir.string());
+    if (it == this->mountMap.end()) {
+        return {};
+    }
+    const auto name = it->second
+        ? get<plist_string>(*(it->second), plist_string{"Name"})
+        : std::nullopt;
+    const auto destName = name
+        ? QString::fromStdString(*name)
+        : QString::fromStdString(dir.filename().string());
+    return BackupLocation::mountPoint(destName, names).child(filename, names);
+}
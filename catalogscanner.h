@@ -0,0 +1,242 @@
+#ifndef CATALOGSCANNER_H
+#define CATALOGSCANNER_H
+
+#include <chrono>
+#include <cstddef> // for std::size_t
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <QObject>
+#include <QPointer>
+#include <QSet>
+#include <QString>
+
+#include "attributerecord.h"
+#include "backuplocation.h"
+#include "directoryreader.h"
+#include "idset.h"
+#include "jobscheduler.h"
+#include "pathtrie.h"
+#include "plist_object.h"
+
+class QThreadPool;
+
+class BackupCatalog;
+
+struct PathInfo {
+    std::filesystem::file_status status;
+    AttributeRecord record;
+    /// @note Only set for the entries of a destination that are scanned.
+    std::optional<BackupLocation> location;
+};
+
+/// @brief What's held for each path that's been scanned or read.
+struct PathNode {
+    std::optional<PathInfo> info;
+    /// @brief Reader of the directory while it's queued or running.
+    DirectoryReader *reader{};
+    /// @brief Scan pass that the path was last seen in.
+    unsigned generation{};
+};
+
+/// @brief What's known from the last scans of a machine directory.
+struct MachineDirScan {
+    /// @brief Stamp of the directory when last read.
+    std::optional<DirectoryStamp> stamp;
+    /// @brief Backups found in the directory.
+    IdSet backups;
+    /// @brief Names of the backups the last tail read was for.
+    QSet<QString> tailNames;
+    /// @brief Whether the directory was listed by the last read.
+    bool listed{true};
+    /// @brief Whether the volumes of a backup in the directory have
+    ///   been read on demand, for the volumes table.
+    bool volumesDemanded{};
+    /// @brief When deletions were last reconciled from a listing.
+    std::chrono::steady_clock::time_point reconciled;
+};
+
+/// @brief Scanner of the mounted destinations into a backup catalog.
+/// @note This is the one discovery pipeline, driven by every front end.
+///   Each mounted destination is scanned by a job of the given
+///   scheduler, staggered from the others & backing off while nothing
+///   changes, & a sweep job drops what's held for paths no longer seen.
+///   What's found is classified by location & written into the catalog,
+///   staging backups & volumes for the front end to apply. Sealed
+///   backups are only listed & machine directories whose stamps are
+///   unchanged only have their tails read.
+class CatalogScanner : public QObject
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    /// @brief Directory reader thread pool priority of reading the
+    ///   volumes of backups that aren't in demand.
+    /// @note This is below that of reading destinations, machines, &
+    ///   backups, so volumes are filled in once those are found.
+    static constexpr auto fillerReadPriority = -1;
+
+    /// @brief Directory reader thread pool priority of reading the
+    ///   volumes of backups that are in demand, like those shown.
+    static constexpr auto demandReadPriority = 1;
+
+    static constexpr auto defaultScanInterval = std::chrono::seconds{10};
+    static constexpr auto defaultGenerations = 3u;
+
+    CatalogScanner(BackupCatalog *catalog,
+                   JobScheduler *scheduler,
+                   QObject *parent = nullptr);
+    ~CatalogScanner() override;
+
+    /// @brief Destinations that are mounted, by mount point.
+    [[nodiscard]] auto mountPoints() const noexcept
+        -> const std::map<std::string, plist_ptr<plist_dict>>&;
+
+    [[nodiscard]] auto scanInterval() const noexcept
+        -> std::chrono::milliseconds;
+    [[nodiscard]] auto generations() const noexcept -> unsigned;
+
+    /// @brief Sets the catalog's destinations from the given ones, as
+    ///   polled from <code>tmutil destinationinfo</code>, & scans
+    ///   those that are mounted.
+    /// @note Everything read from a destination no longer mounted is
+    ///   dropped, as are its scan jobs.
+    void setDestinations(
+        const std::vector<plist_ptr<plist_dict>>& destinations);
+
+    /// @brief Sets the interval between scans of a changing destination.
+    void setScanInterval(std::chrono::milliseconds value);
+
+    /// @brief Sets the number of scan passes that what's held for a
+    ///   path is kept without the path being seen.
+    void setGenerations(unsigned value);
+
+    /// @brief Enables or disables scanning the destination mounted at
+    ///   the given mount point.
+    void setScanEnabled(const std::string& mountPoint, bool value);
+
+    /// @brief Moves a queued read of the given directory ahead of the
+    ///   reads filling in the rest.
+    void prioritizeRead(const std::string& pathName);
+
+    /// @brief Evicts the oldest sealed backups from the catalog beyond
+    ///   the given number, along with what's held for their paths.
+    /// @see BackupCatalog::evictSealedBackups.
+    void evictSealedBackups(std::size_t keep);
+
+signals:
+    /// @brief Signals when entries have been written or staged in the
+    ///   catalog, so any staged can be applied.
+    void staged();
+
+    /// @brief Signals when a directory couldn't be read.
+    void readFailed(const std::filesystem::path& dir, std::error_code ec);
+
+private:
+    struct DestinationScan {
+        JobScheduler::JobId job{};
+        /// @brief Number of directory readers in flight for the scan.
+        int readers{};
+        /// @brief Number of entries found changed by the scan.
+        int changes{};
+        /// @brief Number of consecutive scans that found no changes.
+        int quietScans{};
+    };
+
+    /// @brief Adds & removes the scan jobs of destinations to match the
+    ///   mount points.
+    /// @note The job of a destination that's added is staggered from
+    ///   those of the others, so their runs are spread over the interval.
+    void updateScanJobs();
+
+    /// @brief Interval between scans of a destination.
+    /// @note This is the scan interval for a destination that's
+    ///   changing, doubled per consecutive scan that found no changes
+    ///   up to a limit.
+    [[nodiscard]] auto intervalOf(const DestinationScan& scan) const
+        -> std::chrono::milliseconds;
+
+    /// @brief Ends the scan of the given destination, adapting its
+    ///   interval to whether it found changes.
+    void scanEnded(DestinationScan& scan);
+
+    /// @brief Keeps the sweeps as far apart as the longest scan interval,
+    ///   so each scan pass covers every destination.
+    void updateSweepInterval();
+
+    /// @brief Mount point of the destination that the given path is within.
+    [[nodiscard]] auto mountPointOf(const std::filesystem::path& path) const
+        -> std::optional<std::string>;
+
+    /// @brief Starts reading the given directory unless already reading it.
+    /// @param priority Priority of the read within the directory reader
+    ///   thread pool.
+    void read(const std::string& pathName, int priority = 0);
+
+    /// @brief Drops what's held for paths not seen in the configured
+    ///   number of scan passes.
+    void sweep();
+
+    void handleEntry(const std::filesystem::path& path,
+                     const std::filesystem::file_status& status,
+                     const AttributeRecord& record);
+    void handleEnded(const std::filesystem::path& dir,
+                     std::error_code ec,
+                     const QSet<QString>& filenames);
+    void reportDir(const std::filesystem::path& dir,
+                   const QSet<QString>& filenames);
+    void updateMachine(const BackupLocation& location,
+                       const MachineRecord& record);
+    void updateBackup(const std::filesystem::path& path,
+                      const BackupLocation& location,
+                      const BackupRecord& record);
+    void updateVolume(const std::filesystem::path& path,
+                      const BackupLocation& location,
+                      const VolumeRecord& record);
+    void updateMachineDir(const std::filesystem::path& dir,
+                          const BackupLocation& location,
+                          const QSet<QString>& filenames);
+    void updateVolumeDir(const BackupLocation& location,
+                         const QSet<QString>& filenames);
+
+    /// @brief Sets up the given reader of a machine directory.
+    /// @note Sealed backups are only listed, so their attributes &
+    ///   volumes aren't read again. Unless deletions are due to be
+    ///   reconciled, only the tail of the directory is read when the
+    ///   directory's stamp is unchanged: its unsealed backups & its
+    ///   latest backup.
+    void setUpMachineDirReader(DirectoryReader& reader,
+                               const std::filesystem::path& dir);
+
+    /// @brief Location of the given path from that of its directory.
+    /// @return Location or no value if the directory isn't one that's
+    ///   been scanned as part of a destination.
+    auto childLocation(const std::filesystem::path& path)
+        -> std::optional<BackupLocation>;
+
+    BackupCatalog *catalog{};
+    QPointer<JobScheduler> scheduler;
+    /// @brief Thread pool just for directory reading.
+    QThreadPool *readerPool{};
+    JobScheduler::JobId sweepJob{};
+    std::chrono::milliseconds interval{defaultScanInterval};
+    unsigned generationCount{defaultGenerations};
+
+    std::map<std::string, plist_ptr<plist_dict>> mountMap;
+
+    /// @brief Scans of each destination, by mount point.
+    std::map<std::string, DestinationScan> scans;
+
+    PathTrie<PathNode> pathTrie;
+    /// @brief Number of the current scan pass.
+    unsigned pathGeneration{};
+    std::map<std::filesystem::path, MachineDirScan> machineDirScans;
+};
+
+#endif // CATALOGSCANNER_H
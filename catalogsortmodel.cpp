@@ -0,0 +1,27 @@
+#include "catalogsortmodel.h"
+#include "catalogtablemodel.h"
+
+CatalogSortModel::CatalogSortModel(QObject *parent):
+    QSortFilterProxyModel{parent}
+{
+    this->setDynamicSortFilter(true);
+    this->setSortRole(CatalogTableModel::SortRole);
+}
+
+void CatalogSortModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    this->catalogModel = qobject_cast<const CatalogTableModel*>(sourceModel);
+    QSortFilterProxyModel::setSourceModel(sourceModel);
+}
+
+auto CatalogSortModel::lessThan(const QModelIndex &sourceLeft,
+                                const QModelIndex &sourceRight) const
+    -> bool
+{
+    const auto *model = this->catalogModel;
+    if (!model) {
+        return QSortFilterProxyModel::lessThan(sourceLeft, sourceRight);
+    }
+    return model->sortKey(sourceLeft.row(), sourceLeft.column()) <
+           model->sortKey(sourceRight.row(), sourceRight.column());
+}
@@ -0,0 +1,41 @@
+#ifndef CATALOGSORTMODEL_H
+#define CATALOGSORTMODEL_H
+
+#include <QSortFilterProxyModel>
+
+class CatalogTableModel;
+
+/// @brief Sorting proxy for a <code>CatalogTableModel</code>.
+/// @note Rows are compared by the typed sort keys of their cells. With
+///   the dynamic sort filter, new & changed rows are placed by binary
+///   search amongst the rows already sorted, so an update of k rows
+///   costs O(k log n) comparisons instead of a re-sort of the whole
+///   table. Only changes of the <code>CatalogTableModel::SortRole</code>
+///   re-place rows, so changing a cell's check state doesn't. Falls
+///   back to the default comparison for other models. Each comparison
+///   costs two virtual calls of <code>CatalogTableModel::sortKey</code>
+///   & a comparison of their keys: numbers compare natively, & strings
+///   are the catalog's own, shared rather than copied.
+class CatalogSortModel : public QSortFilterProxyModel
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    explicit CatalogSortModel(QObject *parent = nullptr);
+
+    void setSourceModel(QAbstractItemModel *sourceModel) override;
+
+protected:
+    [[nodiscard]] auto lessThan(const QModelIndex &sourceLeft,
+                                const QModelIndex &sourceRight) const
+        -> bool override;
+
+private:
+    /// @brief Source model if it's a catalog table model.
+    /// @note Kept so comparisons needn't cast the source model.
+    const CatalogTableModel *catalogModel{};
+};
+
+#endif // CATALOGSORTMODEL_H
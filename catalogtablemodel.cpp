@@ -0,0 +1,69 @@
+#include "catalogtablemodel.h"
+
+CatalogTableModel::CatalogTableModel(const BackupCatalog *catalog,
+                                     BackupCatalog::Table table,
+                                     int columns,
+                                     QObject *parent):
+    QAbstractTableModel{parent},
+    source{catalog},
+    table{table},
+    columns{columns}
+{
+    using Table = BackupCatalog::Table;
+    connect(catalog, &BackupCatalog::aboutToInsert,
+            this, [this](Table table, int first, int last){
+        if (table == this->table) {
+            beginInsertRows({}, first, last);
+        }
+    });
+    connect(catalog, &BackupCatalog::inserted,
+            this, [this](Table table, int first, int last){
+        if (table == this->table) {
+            this->entriesInserted(first, last);
+            endInsertRows();
+        }
+    });
+    connect(catalog, &BackupCatalog::aboutToRemove,
+            this, [this](Table table, int first, int last){
+        if (table == this->table) {
+            beginRemoveRows({}, first, last);
+            this->entriesAboutToBeRemoved(first, last);
+        }
+    });
+    connect(catalog, &BackupCatalog::removed,
+            this, [this](Table table, int, int){
+        if (table == this->table) {
+            endRemoveRows();
+        }
+    });
+    connect(catalog, &BackupCatalog::changed,
+            this, [this](Table table, int first, int last){
+        if (table == this->table) {
+            emit dataChanged(this->index(first, 0),
+                             this->index(last, this->columns - 1));
+        }
+    });
+}
+
+auto CatalogTableModel::rowCount(const QModelIndex &parent) const -> int
+{
+    return parent.isValid()? 0: this->source->size(this->table);
+}
+
+auto CatalogTableModel::columnCount(const QModelIndex &parent) const -> int
+{
+    return parent.isValid()? 0: this->columns;
+}
+
+auto CatalogTableModel::catalog() const noexcept -> const BackupCatalog&
+{
+    return *this->source;
+}
+
+void CatalogTableModel::entriesInserted(int, int)
+{
+}
+
+void CatalogTableModel::entriesAboutToBeRemoved(int, int)
+{
+}
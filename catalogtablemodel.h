@@ -0,0 +1,59 @@
+#ifndef CATALOGTABLEMODEL_H
+#define CATALOGTABLEMODEL_H
+
+#include <QAbstractTableModel>
+
+#include "backupcatalog.h"
+#include "sortkey.h"
+
+/// @brief Base of the models presenting a table of a <code>BackupCatalog</code>.
+/// @note Rows are the entries of the catalog's table, in the catalog's
+///   order, so the entries aren't copied & any number of models can
+///   present the same catalog. The catalog's insertions, removals, &
+///   changes of the table are forwarded as the model's own.
+class CatalogTableModel : public QAbstractTableModel
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    /// @brief Role of the typed key that each cell sorts by.
+    /// @see sortKey.
+    static constexpr auto SortRole = int{Qt::UserRole + 1};
+
+    CatalogTableModel(const BackupCatalog *catalog,
+                      BackupCatalog::Table table,
+                      int columns,
+                      QObject *parent = nullptr);
+
+    [[nodiscard]] auto rowCount(const QModelIndex &parent = {}) const
+        -> int override;
+    [[nodiscard]] auto columnCount(const QModelIndex &parent = {}) const
+        -> int override;
+
+    /// @brief Key that the identified cell sorts by.
+    /// @note This is computed from the catalog's typed values rather
+    ///   than from what's displayed, so sorting never parses text. The
+    ///   same key is available as a <code>QVariant</code> from the
+    ///   <code>SortRole</code> of each cell.
+    [[nodiscard]] virtual auto sortKey(int row, int column) const
+        -> SortKey = 0;
+
+protected:
+    [[nodiscard]] auto catalog() const noexcept -> const BackupCatalog&;
+
+    /// @brief Called once the given entries are in the catalog but
+    ///   before views are told of the rows for them.
+    virtual void entriesInserted(int first, int last);
+
+    /// @brief Called while the given entries are still in the catalog.
+    virtual void entriesAboutToBeRemoved(int first, int last);
+
+private:
+    const BackupCatalog *source{};
+    BackupCatalog::Table table{};
+    int columns{};
+};
+
+#endif // CATALOGTABLEMODEL_H
@@ -2,8 +2,11 @@
 #define COROUTINE_H
 
 #include <cassert>
+#include <concepts> // for std::convertible_to
 #include <coroutine>
+#include <exception> // for std::exception_ptr
 #include <optional>
+#include <utility> // for std::exchange, std::forward
 
 template <class TaskType, class ReturnType>
 struct returning_promise {
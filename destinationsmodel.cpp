@@ -0,0 +1,546 @@
+#include <chrono>
+#include <string>
+
+#include <QDateTime>
+#include <QFontDatabase>
+#include <QStringList>
+
+#include "destinationsmodel.h"
+#include "tablecolumndata.h"
+
+namespace {
+
+constexpr auto alignRight = Qt::AlignRight|Qt::AlignVCenter;
+constexpr auto alignLeft = Qt::AlignLeft|Qt::AlignVCenter;
+constexpr auto gigabyte = 1000 * 1000 * 1000;
+constexpr auto megabyte = 1000 * 1000;
+
+/// @brief Maximum number of rates in the throughput sparkline.
+constexpr auto sparklineWidth = std::size_t{40};
+
+/// @note Toplevel key within the status plist dictionary.
+constexpr auto backupPhaseKey = "BackupPhase";
+
+/// @note Toplevel key within the status plist dictionary.
+constexpr auto destinationMountPointKey = "DestinationMountPoint";
+
+/// @note Toplevel key within the status plist dictionary.
+constexpr auto destinationIdKey = "DestinationID";
+
+constexpr auto dateStateChangeKey = "DateOfStateChange";
+
+/// @note Toplevel key within the status plist dictionary. Its
+///   entry value is another dictionary with progress related details.
+constexpr auto progressKey = "Progress";
+
+/// @note Key within the "Progress" entry's dictionary.
+constexpr auto timeRemainingKey = "TimeRemaining";
+
+/// @note Key within the "Progress" entry's dictionary.
+constexpr auto percentKey = "Percent";
+
+/// @note Key within the "Progress" entry's dictionary.
+constexpr auto bytesKey = "bytes";
+
+/// @note Key within the "Progress" entry's dictionary.
+constexpr auto totalBytesKey = "totalBytes";
+
+/// @note Key within the "Progress" entry's dictionary.
+constexpr auto numFilesKey = "files";
+
+/// @note Key within the "Progress" entry's dictionary.
+constexpr auto totalFilesKey = "totalFiles";
+
+auto secondsToUserTime(plist_real value) -> QString
+{
+    static constexpr auto secondsPerMinutes = 60;
+    return QString("~%1 minutes")
+        .arg(QString::number(value / secondsPerMinutes, 'f', 1));
+}
+
+auto decodeBackupPhase(const plist_string &name) -> QString
+{
+    if (name == "ThinningPostBackup") {
+        // a.k.a. "Cleaning up"
+        return "Thinning Post Backup";
+    }
+    if (name == "FindingChanges") {
+        return "Finding Changes";
+    }
+    return QString::fromStdString(name);
+}
+
+auto usage(const std::filesystem::space_info& si)
+    -> std::uintmax_t
+{
+    return si.capacity - si.free;
+}
+
+auto usageRatio(const std::filesystem::space_info& si)
+    -> double
+{
+    return (si.capacity != 0u)
+               ? double(usage(si)) / double(si.capacity)
+               : 0.0;
+}
+
+auto freeRatio(const std::filesystem::space_info& si)
+    -> double
+{
+    return (si.capacity != 0u)
+               ? double(si.free) / double(si.capacity)
+               : 0.0;
+}
+
+auto destsBackupStatText(const plist_dict &status,
+                         const std::optional<std::string> &mp)
+    -> QString
+{
+    // When running...
+    const auto destMP = get<plist_string>(status, destinationMountPointKey);
+    if (destMP && mp && *destMP == *mp) {
+        auto result = QStringList{};
+        if (const auto v = get<plist_string>(status, backupPhaseKey)) {
+            result << decodeBackupPhase(*v);
+        }
+        if (const auto prog = get<plist_dict>(status, progressKey)) {
+            if (const auto v = get<plist_real>(*prog, percentKey)) {
+                result << QString("%1%")
+                              .arg(QString::number(*v * 100.0, 'f', 1));
+            }
+        }
+        return result.join(' ');
+    }
+    return QString{};
+}
+
+auto destsActionText(const plist_dict &status,
+                     const std::optional<std::string> &mp)
+    -> QString
+{
+    const auto destMP = get<plist_string>(status, destinationMountPointKey);
+    return (destMP && mp && destMP == *mp) ? "Stop": "Start";
+}
+
+auto destsBackupStatToolTip(const plist_dict &status,
+                            const std::optional<std::string> &mp,
+                            const ThroughputHistory& throughput)
+    -> QString
+{
+    // When running...
+    const auto destMP =
+        get<plist_string>(status, destinationMountPointKey);
+    if (destMP && mp && *destMP == *mp) {
+        auto result = QStringList{};
+        if (const auto v = get<plist_date>(status, dateStateChangeKey)) {
+            const auto t = std::chrono::system_clock::to_time_t(*v);
+            result << QString("Since: %1...")
+                          .arg(QDateTime::fromSecsSinceEpoch(t)
+                                   .toString());
+        }
+        if (const auto v = get<plist_string>(status, destinationIdKey)) {
+            result << QString("Destination ID: %1.").arg(v->c_str());
+        }
+        if (const auto prog = get<plist_dict>(status, progressKey)) {
+            if (const auto v = get<plist_integer>(*prog, bytesKey)) {
+                result << QString("Number of bytes: %1.").arg(*v);
+            }
+            if (const auto v = get<plist_integer>(*prog, totalBytesKey)) {
+                result << QString("Total bytes: %1.").arg(*v);
+            }
+            if (const auto v = get<plist_integer>(*prog, numFilesKey)) {
+                result << QString("Number of files: %1.").arg(*v);
+            }
+            if (const auto v = get<plist_integer>(*prog, totalFilesKey)) {
+                result << QString("Total files: %1.").arg(*v);
+            }
+            if (const auto v = get<plist_real>(*prog, timeRemainingKey)) {
+                result << QString("Allegedly, %1 remaining.")
+                              .arg(secondsToUserTime(*v));
+            }
+        }
+        if (const auto rate = throughput.rate()) {
+            result << QString("Throughput: %1 MB/s, %2 files/s.")
+                          .arg(rate->bytesPerSecond / megabyte, 0, 'f', 1)
+                          .arg(rate->filesPerSecond, 0, 'f', 1);
+        }
+        if (const auto v = throughput.remaining()) {
+            result << QString("Estimated from throughput, %1 remaining.")
+                          .arg(secondsToUserTime(plist_real(v->count())));
+        }
+        if (const auto v = throughput.sparkline(sparklineWidth);
+            !v.isEmpty()) {
+            result << QString("Recent throughput: %1").arg(v);
+        }
+        return result.join('\n');
+    }
+    return {};
+}
+
+auto destsCapacityData(const std::optional<std::string> &mp,
+                       const std::error_code& ec,
+                       const std::filesystem::space_info& si)
+    -> QVariant
+{
+    return (mp && !ec)
+               ? QVariant{(double(si.capacity) / gigabyte)}
+               : QVariant{};
+}
+
+auto destsCapacityToolTip(
+    const std::optional<std::string> &mp,
+    const std::error_code& ec,
+    const std::filesystem::space_info& si) -> QString
+{
+    if (!mp) {
+        return QString{"No info available on capacity - no mount point for destination."};
+    }
+    if (ec) {
+        return QString{"Error reading mount point space info: %1"}
+            .arg(QString::fromStdString(ec.message()));
+    }
+    return QString{"%1 bytes capacity"}
+        .arg(si.capacity);
+}
+
+auto destsFreeData(const std::optional<std::string> &mp,
+                   const std::error_code& ec,
+                   const std::filesystem::space_info& si)
+    -> QVariant
+{
+    return (mp && !ec)
+               ? QVariant{(double(si.free) / gigabyte)}
+               : QVariant{};
+}
+
+auto destsFreeToolTip(
+    const std::optional<std::string> &mp,
+    const std::error_code& ec,
+    const std::filesystem::space_info& si) -> QString
+{
+    if (!mp) {
+        return QString{"No info available on free space - no mount point for destination."};
+    }
+    if (ec) {
+        return QString{"Error reading mount point space info: %1"}
+            .arg(QString::fromStdString(ec.message()));
+    }
+    return QString{"%1 bytes free out of %2, %3%"}
+        .arg(si.free)
+        .arg(si.capacity)
+        .arg(static_cast<int>(freeRatio(si) * 100.0));
+}
+
+auto mountPointOf(const BackupCatalog::Destination& destination)
+    -> std::optional<std::string>
+{
+    if (destination.mountPoint.isEmpty()) {
+        return {};
+    }
+    return destination.mountPoint.toStdString();
+}
+
+auto destsUseToolTip(const std::filesystem::space_info& si) -> QString
+{
+    return QString("Used %1% (%2b of %3b with %4b remaining).")
+        .arg(static_cast<int>(usageRatio(si) * 100.0))
+        .arg(usage(si))
+        .arg(si.capacity)
+        .arg(si.free);
+}
+
+}
+
+DestinationsModel::DestinationsModel(const BackupCatalog *catalog,
+                                     QObject *parent):
+    CatalogTableModel{catalog, BackupCatalog::Table::Destinations,
+                      DestinationsColumn::count, parent},
+    status{std::make_shared<const plist_dict>()},
+    fixedFont{QFontDatabase::systemFont(QFontDatabase::FixedFont)},
+    smallFont{QFontDatabase::systemFont(QFontDatabase::SmallestReadableFont)}
+{
+}
+
+auto DestinationsModel::data(const QModelIndex &index, int role) const
+    -> QVariant
+{
+    if (!index.isValid()) {
+        return {};
+    }
+    if (role == SortRole) {
+        return toVariant(this->sortKey(index.row(), index.column()));
+    }
+    const auto& row = this->catalog().destinations()[index.row()];
+    const auto& state = this->rowStates[index.row()];
+    const auto mp = mountPointOf(row);
+    const auto ec = state.space? state.error: std::error_code{};
+    const auto si = state.space.value_or(std::filesystem::space_info{});
+    const auto known = mp && state.space && !state.error;
+    switch (index.column()) {
+    case DestinationsColumn::Name:
+        switch (role) {
+        case Qt::DisplayRole:
+            return this->catalog().names().destinations.string(row.name);
+        case Qt::CheckStateRole:
+            return static_cast<int>(state.checked);
+        case Qt::ToolTipRole:
+            return QString{"Backup destination."};
+        }
+        break;
+    case DestinationsColumn::ID:
+        switch (role) {
+        case Qt::DisplayRole:
+            return row.id;
+        case Qt::FontRole:
+            return this->fixedFont;
+        }
+        break;
+    case DestinationsColumn::Kind:
+        if (role == Qt::DisplayRole) {
+            return row.kind;
+        }
+        break;
+    case DestinationsColumn::Mount:
+        switch (role) {
+        case Qt::DisplayRole:
+            return row.mountPoint;
+        case Qt::FontRole:
+            return this->fixedFont;
+        case Qt::TextAlignmentRole:
+            return QVariant::fromValue(alignLeft);
+        }
+        return {};
+    case DestinationsColumn::Use:
+        switch (role) {
+        case Qt::DisplayRole:
+            return known
+                ? QString("%1%").arg(static_cast<int>(usageRatio(si) * 100.0))
+                : QVariant{};
+        case Qt::UserRole:
+            return known
+                ? QVariant{static_cast<int>(usageRatio(si) * 100.0)}
+                : QVariant{};
+        case Qt::ToolTipRole:
+            return known? destsUseToolTip(si): QVariant{};
+        case Qt::FontRole:
+            return this->smallFont;
+        }
+        break;
+    case DestinationsColumn::Capacity:
+        switch (role) {
+        case Qt::DisplayRole:
+            return state.space? destsCapacityData(mp, ec, si): QVariant{};
+        case Qt::ToolTipRole:
+            if (!state.space) {
+                return mp? QVariant{}: destsCapacityToolTip(mp, ec, si);
+            }
+            return QString{"%1\nSpace info took %2 ms to get."}
+                .arg(destsCapacityToolTip(mp, ec, si))
+                .arg(double(state.latency.count()) / 1000, 0, 'f', 1);
+        case Qt::FontRole:
+            return this->fixedFont;
+        case Qt::TextAlignmentRole:
+            return QVariant::fromValue(alignRight);
+        }
+        return {};
+    case DestinationsColumn::Free:
+        switch (role) {
+        case Qt::DisplayRole:
+            return state.space? destsFreeData(mp, ec, si): QVariant{};
+        case Qt::ToolTipRole:
+            return (state.space || !mp)
+                ? destsFreeToolTip(mp, ec, si)
+                : QVariant{};
+        case Qt::FontRole:
+            return this->fixedFont;
+        case Qt::TextAlignmentRole:
+            return QVariant::fromValue(alignRight);
+        }
+        return {};
+    case DestinationsColumn::Action:
+        if (role == Qt::DisplayRole) {
+            return destsActionText(*(this->status), mp);
+        }
+        break;
+    case DestinationsColumn::BackupStat:
+        switch (role) {
+        case Qt::DisplayRole:
+            return destsBackupStatText(*(this->status), mp);
+        case Qt::ToolTipRole:
+            return destsBackupStatToolTip(*(this->status), mp,
+                                          state.throughput);
+        case Qt::FontRole:
+            return this->fixedFont;
+        }
+        break;
+    }
+    if (role == Qt::TextAlignmentRole) {
+        return QVariant::fromValue(Qt::Alignment{Qt::AlignCenter});
+    }
+    return {};
+}
+
+auto DestinationsModel::sortKey(int row, int column) const -> SortKey
+{
+    // Per ten thousand, to order usages that display the same percent.
+    constexpr auto usageScale = 10000.0;
+    const auto& entry = this->catalog().destinations()[row];
+    const auto& state = this->rowStates[row];
+    const auto known = mountPointOf(entry) && state.space && !state.error;
+    switch (column) {
+    case DestinationsColumn::Name:
+        return this->catalog().names().destinations.string(entry.name);
+    case DestinationsColumn::ID:
+        return entry.id;
+    case DestinationsColumn::Kind:
+        return entry.kind;
+    case DestinationsColumn::Mount:
+        return entry.mountPoint;
+    case DestinationsColumn::Use:
+        return known
+            ? SortKey{qint64(usageRatio(*state.space) * usageScale)}
+            : SortKey{};
+    case DestinationsColumn::Capacity:
+        return known? SortKey{qint64(state.space->capacity)}: SortKey{};
+    case DestinationsColumn::Free:
+        return known? SortKey{qint64(state.space->free)}: SortKey{};
+    case DestinationsColumn::Action:
+    case DestinationsColumn::BackupStat:
+        return this->data(this->index(row, column)).toString();
+    }
+    return {};
+}
+
+auto DestinationsModel::headerData(int section,
+                                   Qt::Orientation orientation,
+                                   int role) const -> QVariant
+{
+    static const auto columns = std::map<int, TableColumnData>{
+        {DestinationsColumn::Name, {"Name", "Destination name, also refered to as a volume name."}},
+        {DestinationsColumn::ID, {"ID", "Identifier for destination."}},
+        {DestinationsColumn::Kind, {"Kind", "The kind of the destination."}},
+        {DestinationsColumn::Mount, {"Mount Point", "Path at which the destination is mounted at."}},
+        {DestinationsColumn::Use, {"Usage", "Percent usage of the mounted destination."}},
+        {DestinationsColumn::Capacity,
+         {"Capacity",
+          "Capacity of the destination.",
+          Qt::AlignTrailing|Qt::AlignVCenter}},
+        {DestinationsColumn::Free,
+         {"Free",
+          "Free space within the destination.",
+          Qt::AlignTrailing|Qt::AlignVCenter}},
+        {DestinationsColumn::Action, {"Action", "Backup action for the destination."}},
+        {DestinationsColumn::BackupStat,
+         {"Backup Status",
+          "Backup phase & more when backup running."}},
+    };
+    if (orientation != Qt::Horizontal) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+    return ::headerData(columns, section, role);
+}
+
+auto DestinationsModel::flags(const QModelIndex &index) const
+    -> Qt::ItemFlags
+{
+    if (!index.isValid()) {
+        return Qt::NoItemFlags;
+    }
+    const auto& row = this->catalog().destinations()[index.row()];
+    if (row.mountPoint.isEmpty()) {
+        return (index.column() == DestinationsColumn::Name)
+            ? Qt::ItemIsUserCheckable
+            : Qt::NoItemFlags;
+    }
+    if (index.column() == DestinationsColumn::Name) {
+        return Qt::ItemIsEnabled|Qt::ItemIsUserCheckable;
+    }
+    return Qt::ItemIsEnabled;
+}
+
+auto DestinationsModel::setData(const QModelIndex &index,
+                                const QVariant &value,
+                                int role) -> bool
+{
+    if (!index.isValid() || (index.column() != DestinationsColumn::Name) ||
+        (role != Qt::CheckStateRole)) {
+        return false;
+    }
+    auto& state = this->rowStates[index.row()];
+    const auto checked = static_cast<Qt::CheckState>(value.toInt());
+    if (state.checked == checked) {
+        return true;
+    }
+    const auto wasChecked = (state.checked != Qt::Unchecked);
+    state.checked = checked;
+    emit dataChanged(index, index, {Qt::CheckStateRole});
+    if (wasChecked != (checked != Qt::Unchecked)) {
+        emit checkedChanged(this->catalog().destinations()[index.row()].name,
+                            !wasChecked);
+    }
+    return true;
+}
+
+void DestinationsModel::setSpace(const QString& id,
+                                 const std::filesystem::space_info& info,
+                                 std::error_code ec,
+                                 std::chrono::microseconds latency)
+{
+    const auto found = this->catalog().findDestination(id);
+    if (found < 0) {
+        return;
+    }
+    auto& state = this->rowStates[found];
+    state.latency = latency;
+    if (state.space && (*state.space == info) && (state.error == ec)) {
+        return;
+    }
+    state.space = info;
+    state.error = ec;
+    emit dataChanged(this->index(found, DestinationsColumn::Use),
+                     this->index(found, DestinationsColumn::Free));
+}
+
+void DestinationsModel::setStatus(const plist_ptr<plist_dict>& status)
+{
+    this->status = status? status: std::make_shared<const plist_dict>();
+    const auto id = get<plist_string>(*(this->status), destinationIdKey);
+    const auto prog = get<plist_dict>(*(this->status), progressKey);
+    const auto found = id
+        ? this->catalog().findDestination(QString::fromStdString(*id))
+        : -1;
+    if (prog && (found >= 0)) {
+        this->rowStates[found].throughput.record({
+            .bytes = get<plist_integer>(*prog, bytesKey).value_or(0),
+            .totalBytes = get<plist_integer>(*prog, totalBytesKey).value_or(0),
+            .files = get<plist_integer>(*prog, numFilesKey).value_or(0),
+            .totalFiles = get<plist_integer>(*prog, totalFilesKey).value_or(0),
+            .time = ThroughputHistory::Clock::now(),
+        });
+    }
+    const auto count = this->rowCount();
+    if (count > 0) {
+        emit dataChanged(this->index(0, DestinationsColumn::Action),
+                         this->index(count - 1, DestinationsColumn::BackupStat));
+    }
+}
+
+void DestinationsModel::entriesInserted(int first, int last)
+{
+    const auto& destinations = this->catalog().destinations();
+    this->rowStates.insert(this->rowStates.begin() + first,
+                           std::size_t(last - first + 1), RowState{});
+    for (auto i = first; i <= last; ++i) {
+        // Destinations that aren't mounted start out unchecked & hidden.
+        if (destinations[i].mountPoint.isEmpty()) {
+            this->rowStates[i].checked = Qt::Unchecked;
+            emit checkedChanged(destinations[i].name, false);
+        }
+    }
+}
+
+void DestinationsModel::entriesAboutToBeRemoved(int first, int last)
+{
+    this->rowStates.erase(this->rowStates.begin() + first,
+                          this->rowStates.begin() + last + 1);
+}
@@ -0,0 +1,103 @@
+#ifndef DESTINATIONSMODEL_H
+#define DESTINATIONSMODEL_H
+
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <system_error>
+#include <vector>
+
+#include <QFont>
+
+#include "catalogtablemodel.h"
+#include "plist_object.h"
+#include "throughputhistory.h"
+
+// A namespace scoped enum for the destinations table columns...
+namespace DestinationsColumn {
+enum Enum: int {
+    Name = 0,
+    ID,
+    Kind,
+    Mount,
+    Use,
+    Capacity,
+    Free,
+    Action,
+    BackupStat,
+};
+constexpr auto count = 9;
+}
+
+/// @brief Model for the destinations table of a <code>BackupCatalog</code>.
+/// @note Rows are the catalog's destinations, reconciled by their IDs,
+///   so an unchanged list of destinations changes no rows. Besides
+///   whether each row is checked, this holds the last space info of
+///   each destination & the last backup status, from which the usage,
+///   action, & backup status columns are derived. The usage percent is
+///   available from the <code>Qt::UserRole</code> of the Use column.
+///   The progress of the backups of each destination is kept in its
+///   throughput history, for estimating throughput & time remaining.
+class DestinationsModel : public CatalogTableModel
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    explicit DestinationsModel(const BackupCatalog *catalog,
+                               QObject *parent = nullptr);
+
+    [[nodiscard]] auto data(const QModelIndex &index,
+                            int role = Qt::DisplayRole) const
+        -> QVariant override;
+    [[nodiscard]] auto sortKey(int row, int column) const
+        -> SortKey override;
+    [[nodiscard]] auto headerData(int section,
+                                  Qt::Orientation orientation,
+                                  int role = Qt::DisplayRole) const
+        -> QVariant override;
+    [[nodiscard]] auto flags(const QModelIndex &index) const
+        -> Qt::ItemFlags override;
+    auto setData(const QModelIndex &index, const QVariant &value,
+                 int role = Qt::EditRole) -> bool override;
+
+    /// @brief Sets the space info of the identified destination.
+    /// @param latency How long getting the info took.
+    /// @note Rows are only signaled as changed if the info differs.
+    void setSpace(const QString& id,
+                  const std::filesystem::space_info& info,
+                  std::error_code ec,
+                  std::chrono::microseconds latency = {});
+
+    /// @brief Sets the backup status that the action & backup status
+    ///   columns are derived from.
+    /// @note The status's progress, if any, is recorded in the
+    ///   throughput history of its destination.
+    void setStatus(const plist_ptr<plist_dict>& status);
+
+signals:
+    /// @brief Signals when whether the named destination is checked
+    ///   has changed.
+    void checkedChanged(NameId name, bool checked);
+
+protected:
+    void entriesInserted(int first, int last) override;
+    void entriesAboutToBeRemoved(int first, int last) override;
+
+private:
+    struct RowState {
+        Qt::CheckState checked{Qt::Checked};
+        std::optional<std::filesystem::space_info> space;
+        std::error_code error;
+        std::chrono::microseconds latency{};
+        ThroughputHistory throughput;
+    };
+
+    std::vector<RowState> rowStates;
+    plist_ptr<plist_dict> status;
+    QFont fixedFont;
+    QFont smallFont;
+};
+
+#endif // DESTINATIONSMODEL_H
@@ -4,15 +4,19 @@
 #include <optional>
 #include <stdexcept>
 #include <sstream>
+#include <utility> // for std::as_const
 
 #include <QDeadlineTimer>
 #include <QEventLoop>
-#include <QTreeWidgetItem>
+#include <QtDebug>
 
 #include "directoryreader.h"
 
 namespace {
 
+/// @brief Name of the symbolic link to the latest backup of a machine.
+constexpr auto latestName = "Latest";
+
 template <class T>
 struct AtomicIntegerHolder
 {
@@ -101,23 +105,16 @@ auto readAttribute(const std::filesystem::path &path,
     return buffer;
 }
 
-auto getAttributes(const std::filesystem::path &path,
-                   const std::vector<std::string>& xattrNames)
-    -> std::optional<QMap<QString, QByteArray>>
+auto readStamp(const std::filesystem::path &dir,
+               std::error_code &ec)
+    -> DirectoryStamp
 {
-    auto attrs = QMap<QString, QByteArray>{};
-    for (const auto& attrName: xattrNames) {
-        auto ec = std::error_code{};
-        const auto buffer = readAttribute(path, attrName, ec);
-        if (ec == std::make_error_code(std::errc::no_such_file_or_directory)) {
-            return {};
-        }
-        if (ec) {
-            continue;
-        }
-        attrs.insert(QString::fromStdString(attrName), buffer);
+    auto result = DirectoryStamp{};
+    result.modified = std::filesystem::last_write_time(dir, ec);
+    if (!ec) {
+        result.links = std::filesystem::hard_link_count(dir, ec);
     }
-    return {attrs};
+    return result;
 }
 
 auto okay(QDir::Filters filters,
@@ -235,6 +232,12 @@ auto DirectoryReader::readAttributes() const noexcept
     return this->readAttrs;
 }
 
+auto DirectoryReader::listOnlyNames() const
+    -> QSet<QString>
+{
+    return this->listOnly;
+}
+
 void DirectoryReader::setFilter(QDir::Filters filters)
 {
     this->filters = filters;
@@ -245,6 +248,17 @@ void DirectoryReader::setReadAttributes(bool value)
     this->readAttrs = value;
 }
 
+void DirectoryReader::setListOnlyNames(QSet<QString> names)
+{
+    this->listOnly = std::move(names);
+}
+
+void DirectoryReader::setTail(std::optional<DirectoryStamp> stamp,
+                              QSet<QString> names)
+{
+    this->tail = Tail{stamp, std::move(names)};
+}
+
 void DirectoryReader::run()
 {
     const AtomicIntegerHolder hold(&(this->running), true);
@@ -260,6 +274,18 @@ void DirectoryReader::read()
     using std::filesystem::directory_options;
 
     auto ec = std::error_code{};
+    if (this->tail) {
+        const auto stamp = readStamp(this->directory, ec);
+        if (!ec) {
+            const auto unchanged = (this->tail->stamp == stamp);
+            emit stamped(this->directory, stamp, !unchanged);
+            if (unchanged) {
+                this->readTail();
+                return;
+            }
+        }
+        ec = {};
+    }
     const auto options = directory_options::skip_permission_denied;
     const auto it = directory_iterator{this->directory, options, ec};
     if (ec) {
@@ -280,6 +306,32 @@ void DirectoryReader::read(const std::filesystem::directory_iterator& it)
     emit ended(this->directory, std::error_code{}, filenames);
 }
 
+void DirectoryReader::readTail()
+{
+    auto names = this->tail->names;
+    auto ec = std::error_code{};
+    const auto latest = std::filesystem::read_symlink(
+        this->directory / latestName, ec);
+    if (!ec && latest.has_filename()) {
+        names.insert(QString::fromStdString(latest.filename().string()));
+    }
+    auto filenames = QSet<QString>{};
+    for (const auto& name: std::as_const(names)) {
+        if (this->isInterruptionRequested()) {
+            break;
+        }
+        const auto dirEntry = std::filesystem::directory_entry{
+            this->directory / name.toStdString(), ec};
+        if (ec || !dirEntry.exists(ec)) {
+            continue;
+        }
+        if (!read(dirEntry, filenames)) {
+            break;
+        }
+    }
+    emit ended(this->directory, std::error_code{}, filenames);
+}
+
 auto DirectoryReader::read(const std::filesystem::directory_entry &dirEntry,
                            QSet<QString> &filenames)
     -> bool
@@ -290,6 +342,13 @@ auto DirectoryReader::read(const std::filesystem::directory_entry &dirEntry,
     if (!okay(this->filters, filename)) {
         return true;
     }
+    if (!this->listOnly.isEmpty()) {
+        auto name = QString::fromStdString(filename);
+        if (this->listOnly.contains(name)) {
+            filenames.insert(std::move(name));
+            return true;
+        }
+    }
     const auto status = (this->filters & QDir::NoSymLinks)
                             ? dirEntry.symlink_status(ec)
                             : dirEntry.status(ec);
@@ -305,7 +364,7 @@ auto DirectoryReader::read(const std::filesystem::directory_entry &dirEntry,
         return true;
     }
     if (this->readAttrs) {
-        auto xattrMap = QMap<QString, QByteArray>{};
+        auto builder = AttributeRecordBuilder{};
         const auto xattrNames = readAttributeNames(path, ec);
         if (ec == std::make_error_code(std::errc::no_such_file_or_directory)) {
             return true;
@@ -314,6 +373,9 @@ auto DirectoryReader::read(const std::filesystem::directory_entry &dirEntry,
             if (this->isInterruptionRequested()) {
                 return false;
             }
+            if (!AttributeRecordBuilder::decodes(attrName)) {
+                continue;
+            }
             const auto buffer = readAttribute(path, attrName, ec);
             if (ec == std::make_error_code(std::errc::no_such_file_or_directory)) {
                 break;
@@ -321,15 +383,15 @@ auto DirectoryReader::read(const std::filesystem::directory_entry &dirEntry,
             if (ec) {
                 continue;
             }
-            xattrMap.insert(QString::fromStdString(attrName), buffer);
+            builder.decode(attrName, buffer);
         }
         if (ec == std::make_error_code(std::errc::no_such_file_or_directory)) {
             return true;
         }
-        emit entry(path, status, xattrMap);
+        emit entry(path, status, std::move(builder).record());
     }
     else {
-        emit entry(path, status, QMap<QString,QByteArray>{});
+        emit entry(path, status, AttributeRecord{});
     }
     filenames.insert(QString::fromStdString(filename));
     return true;
@@ -1,18 +1,31 @@
 #ifndef DIRECTORYREADER_H
 #define DIRECTORYREADER_H
 
+#include <cstdint> // for std::uintmax_t
 #include <filesystem>
+#include <optional>
 
 #include <QByteArray>
 #include <QDir>
-#include <QMap>
 #include <QPair>
 #include <QSet>
 #include <QString>
 #include <QRunnable>
 #include <QAtomicInteger>
 
-class QTreeWidgetItem;
+#include "attributerecord.h"
+
+/// @brief Modification time & link count of a directory.
+/// @note Adding or removing entries of a directory changes these, so
+///   an unchanged stamp means the directory's listing is unchanged.
+struct DirectoryStamp
+{
+    std::filesystem::file_time_type modified;
+    std::uintmax_t links{};
+
+    friend auto operator==(const DirectoryStamp&, const DirectoryStamp&)
+        -> bool = default;
+};
 
 class DirectoryReader: public QObject, public QRunnable
 {
@@ -32,6 +45,15 @@ public:
     [[nodiscard]] auto readAttributes() const noexcept
         -> bool;
 
+    /// @brief Names of the entries that are only listed.
+    /// @note Such entries are included in the filenames the reader ends
+    ///   with, but their statuses & attributes aren't read & they're
+    ///   not signaled as entries. This is for entries known not to
+    ///   change, like sealed backups, so that refreshing them only
+    ///   costs the directory listing.
+    [[nodiscard]] auto listOnlyNames() const
+        -> QSet<QString>;
+
     auto isRunning() const noexcept -> bool;
     auto isInterruptionRequested() const noexcept -> bool;
 
@@ -39,19 +61,39 @@ public:
 
     void setFilter(QDir::Filters filters);
     void setReadAttributes(bool value);
+    void setListOnlyNames(QSet<QString> names);
+
+    /// @brief Sets the reader to read only the tail of the directory if
+    ///   its stamp is still the given one.
+    /// @note With a tail set, the directory's stamp is read & signaled
+    ///   first. If it equals the given stamp, only the named entries &
+    ///   the target of any "Latest" symbolic link are read, instead of
+    ///   listing the directory, & the reader ends with just the names
+    ///   of those found. Otherwise the directory is listed as usual.
+    void setTail(std::optional<DirectoryStamp> stamp, QSet<QString> names);
 
 signals:
+    /// @param record Record decoded from the entry's attributes, on
+    ///   the reading thread.
     void entry(const std::filesystem::path &path,
                const std::filesystem::file_status &status,
-               const QMap<QString, QByteArray> &attrs);
+               const AttributeRecord &record);
     void ended(const std::filesystem::path &dir,
                std::error_code ec,
                const QSet<QString> &filenames);
 
+    /// @brief Signals the stamp of the directory when a tail is set.
+    /// @param listed Whether the directory is listed, or else only its
+    ///   tail is read.
+    void stamped(const std::filesystem::path &dir,
+                 const DirectoryStamp &stamp,
+                 bool listed);
+
 private:
     void run() override;
     void read();
     void read(const std::filesystem::directory_iterator &it);
+    void readTail();
     auto read(const std::filesystem::directory_entry &dirEntry,
               QSet<QString> &filenames) -> bool;
 
@@ -61,6 +103,13 @@ private:
     std::filesystem::path directory;
     QDir::Filters filters{QDir::Dirs|QDir::NoSymLinks};
     bool readAttrs{true};
+    QSet<QString> listOnly;
+
+    struct Tail {
+        std::optional<DirectoryStamp> stamp;
+        QSet<QString> names;
+    };
+    std::optional<Tail> tail;
 };
 
 #endif // DIRECTORYREADER_H
@@ -0,0 +1,189 @@
+#ifndef IDSET_H
+#define IDSET_H
+
+#include <algorithm> // for std::min
+#include <bit>
+#include <cstddef> // for std::size_t
+#include <cstdint>
+#include <vector>
+
+/// @brief Small integer identifier of an interned name.
+using NameId = std::uint32_t;
+
+/// @brief Set of name identifiers stored as a bitset.
+/// @note Set operations between sets work a whole word of identifiers
+///   at a time. Memory use is proportional to the largest identifier
+///   held, so this is meant for densely assigned identifiers such as
+///   those from a <code>StringInterner</code>.
+class IdSet
+{
+public:
+    using word_type = std::uint64_t;
+    static constexpr auto wordBits = std::size_t{64};
+
+    IdSet() = default;
+
+    [[nodiscard]] auto test(NameId id) const noexcept -> bool
+    {
+        const auto i = id / wordBits;
+        return (i < this->words.size()) &&
+               ((this->words[i] & bit(id)) != 0u);
+    }
+
+    void set(NameId id)
+    {
+        const auto i = id / wordBits;
+        if (i >= this->words.size()) {
+            this->words.resize(i + 1u);
+        }
+        this->words[i] |= bit(id);
+    }
+
+    void reset(NameId id) noexcept
+    {
+        const auto i = id / wordBits;
+        if (i < this->words.size()) {
+            this->words[i] &= ~bit(id);
+        }
+    }
+
+    /// @brief Sets or resets the given identifier.
+    /// @return Whether this set changed.
+    auto assign(NameId id, bool value) -> bool
+    {
+        if (this->test(id) == value) {
+            return false;
+        }
+        if (value) {
+            this->set(id);
+        }
+        else {
+            this->reset(id);
+        }
+        return true;
+    }
+
+    void clear() noexcept
+    {
+        this->words.clear();
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool
+    {
+        for (const auto word: this->words) {
+            if (word != 0u) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    [[nodiscard]] auto count() const noexcept -> std::size_t
+    {
+        auto result = std::size_t{};
+        for (const auto word: this->words) {
+            result += static_cast<std::size_t>(std::popcount(word));
+        }
+        return result;
+    }
+
+    /// @brief Adds the identifiers of the other set to this set.
+    /// @return Whether this set changed.
+    auto merge(const IdSet& other) -> bool
+    {
+        if (this->words.size() < other.words.size()) {
+            this->words.resize(other.words.size());
+        }
+        auto changed = false;
+        const auto n = other.words.size();
+        for (auto i = std::size_t{}; i < n; ++i) {
+            const auto word = this->words[i] | other.words[i];
+            changed = changed || (word != this->words[i]);
+            this->words[i] = word;
+        }
+        return changed;
+    }
+
+    /// @brief Removes the identifiers of the other set from this set.
+    /// @return Whether this set changed.
+    auto subtract(const IdSet& other) noexcept -> bool
+    {
+        auto changed = false;
+        const auto n = std::min(this->words.size(), other.words.size());
+        for (auto i = std::size_t{}; i < n; ++i) {
+            const auto word = this->words[i] & ~other.words[i];
+            changed = changed || (word != this->words[i]);
+            this->words[i] = word;
+        }
+        return changed;
+    }
+
+    /// @brief Whether any identifier is in both this & the other set.
+    [[nodiscard]] auto intersects(const IdSet& other) const noexcept
+        -> bool
+    {
+        const auto n = std::min(this->words.size(), other.words.size());
+        for (auto i = std::size_t{}; i < n; ++i) {
+            if ((this->words[i] & other.words[i]) != 0u) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Whether any identifier of this set isn't in the other set.
+    [[nodiscard]] auto anyNotIn(const IdSet& other) const noexcept
+        -> bool
+    {
+        const auto n = this->words.size();
+        for (auto i = std::size_t{}; i < n; ++i) {
+            const auto mask = (i < other.words.size())? other.words[i]: 0u;
+            if ((this->words[i] & ~mask) != 0u) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Calls the given function with each identifier in order.
+    template <class Function>
+    void forEach(Function function) const
+    {
+        const auto n = this->words.size();
+        for (auto i = std::size_t{}; i < n; ++i) {
+            for (auto word = this->words[i]; word != 0u; word &= word - 1u) {
+                function(static_cast<NameId>(
+                    i * wordBits + std::size_t(std::countr_zero(word))));
+            }
+        }
+    }
+
+    friend auto operator==(const IdSet& lhs, const IdSet& rhs) noexcept
+        -> bool
+    {
+        const auto& shorter = (lhs.words.size() < rhs.words.size())? lhs: rhs;
+        const auto& longer = (&shorter == &lhs)? rhs: lhs;
+        const auto n = shorter.words.size();
+        for (auto i = std::size_t{}; i < n; ++i) {
+            if (shorter.words[i] != longer.words[i]) {
+                return false;
+            }
+        }
+        for (auto i = n; i < longer.words.size(); ++i) {
+            if (longer.words[i] != 0u) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    static constexpr auto bit(NameId id) noexcept -> word_type
+    {
+        return word_type{1u} << (id % wordBits);
+    }
+
+    std::vector<word_type> words;
+};
+
+#endif // IDSET_H
@@ -0,0 +1,41 @@
+#include "idsetstrings.h"
+#include "stringinterner.h"
+
+auto toStringList(const IdSet& ids,
+                  const StringInterner& names,
+                  const int max,
+                  const QString &etc)
+    -> QStringList
+{
+    QStringList result;
+    ids.forEach([&result,&names](NameId id){
+        result << names.string(id);
+    });
+    result.sort();
+    if ((max >= 0) && (max < result.size())) {
+        result.resize(max);
+        result << etc;
+    }
+    return result;
+}
+
+auto firstToLastToolTip(const IdSet& ids,
+                        const StringInterner& names)
+    -> QString
+{
+    const QString *first{};
+    const QString *last{};
+    ids.forEach([&](NameId id){
+        const auto& name = names.string(id);
+        if (!first || (name < *first)) {
+            first = &name;
+        }
+        if (!last || (*last < name)) {
+            last = &name;
+        }
+    });
+    if (!first) {
+        return {};
+    }
+    return QString{"%1...%2"}.arg(*first, *last);
+}
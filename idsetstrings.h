@@ -0,0 +1,26 @@
+#ifndef IDSETSTRINGS_H
+#define IDSETSTRINGS_H
+
+#include <QString>
+#include <QStringList>
+
+#include "idset.h"
+
+class StringInterner;
+
+constexpr auto maxToolTipStringList = 10;
+
+/// @brief Gets the sorted names of the given identifiers.
+/// @note At most <code>max</code> names are returned, followed by
+///   <code>etc</code> if there were more, unless <code>max</code> is
+///   negative.
+auto toStringList(const IdSet& ids,
+                  const StringInterner& names,
+                  int max = -1,
+                  const QString &etc = "...") -> QStringList;
+
+/// @brief Gets the first & last of the names of the given identifiers.
+auto firstToLastToolTip(const IdSet& ids,
+                        const StringInterner& names) -> QString;
+
+#endif // IDSETSTRINGS_H
@@ -0,0 +1,230 @@
+#include <algorithm> // for std::max, std::sort
+#include <utility> // for std::move
+
+#include <QtDebug>
+#include <QTimer>
+
+#include "jobscheduler.h"
+
+namespace {
+
+/// @brief Least interval of a job, so a job can't keep a wakeup busy.
+constexpr auto minimumInterval = std::chrono::milliseconds{1};
+
+}
+
+JobScheduler::JobScheduler(QObject *parent):
+    QObject{parent},
+    timer{new QTimer{this}}
+{
+    this->timer->setSingleShot(true);
+    connect(this->timer, &QTimer::timeout,
+            this, &JobScheduler::wakeUp);
+}
+
+JobScheduler::~JobScheduler() = default;
+
+auto JobScheduler::slack() const noexcept -> std::chrono::milliseconds
+{
+    return this->slackTime;
+}
+
+void JobScheduler::setSlack(std::chrono::milliseconds value)
+{
+    this->slackTime = std::max(value, std::chrono::milliseconds{});
+    this->arm();
+}
+
+auto JobScheduler::add(const QString& name,
+                       std::chrono::milliseconds interval,
+                       Run run,
+                       std::chrono::milliseconds delay) -> JobId
+{
+    const auto id = ++(this->lastId);
+    this->jobMap.emplace(id, Job{
+        .name = name,
+        .interval = std::max(interval, minimumInterval),
+        .run = std::move(run),
+        .next = Clock::now() + delay,
+    });
+    this->arm();
+    return id;
+}
+
+void JobScheduler::remove(JobId id)
+{
+    if (this->jobMap.erase(id) > 0u) {
+        this->arm();
+    }
+}
+
+void JobScheduler::setInterval(JobId id, std::chrono::milliseconds value)
+{
+    const auto it = this->jobMap.find(id);
+    if (it == this->jobMap.end()) {
+        return;
+    }
+    auto& job = it->second;
+    value = std::max(value, minimumInterval);
+    job.next += value - job.interval;
+    job.interval = value;
+    this->arm();
+}
+
+void JobScheduler::runIn(JobId id, std::chrono::milliseconds delay)
+{
+    const auto it = this->jobMap.find(id);
+    if (it == this->jobMap.end()) {
+        return;
+    }
+    it->second.next = Clock::now() + delay;
+    this->arm();
+}
+
+void JobScheduler::setEnabled(JobId id, bool value)
+{
+    const auto it = this->jobMap.find(id);
+    if ((it == this->jobMap.end()) || (it->second.enabled == value)) {
+        return;
+    }
+    it->second.enabled = value;
+    this->arm();
+}
+
+void JobScheduler::finished(JobId id)
+{
+    const auto it = this->jobMap.find(id);
+    if (it != this->jobMap.end()) {
+        it->second.inFlight = false;
+    }
+}
+
+auto JobScheduler::nextRun(JobId id) const -> std::optional<Clock::time_point>
+{
+    const auto it = this->jobMap.find(id);
+    if ((it == this->jobMap.end()) || !it->second.enabled) {
+        return {};
+    }
+    return it->second.next;
+}
+
+auto JobScheduler::staggeredDelay(const std::vector<JobId>& peers,
+                                  std::chrono::milliseconds interval) const
+    -> std::chrono::milliseconds
+{
+    const auto period = std::max(interval, minimumInterval).count();
+    const auto now = Clock::now();
+    auto phases = std::vector<std::chrono::milliseconds::rep>{};
+    phases.reserve(peers.size());
+    for (const auto id: peers) {
+        const auto it = this->jobMap.find(id);
+        if ((it == this->jobMap.end()) || !it->second.enabled) {
+            continue;
+        }
+        const auto offset = std::chrono::duration_cast<
+            std::chrono::milliseconds>(it->second.next - now).count();
+        phases.push_back(((offset % period) + period) % period);
+    }
+    if (phases.empty()) {
+        return {};
+    }
+    std::sort(phases.begin(), phases.end());
+    // The gap from the last phase, wrapping around to the first.
+    auto start = phases.back();
+    auto gap = phases.front() + period - phases.back();
+    for (auto i = 1u; i < phases.size(); ++i) {
+        if ((phases[i] - phases[i - 1]) > gap) {
+            start = phases[i - 1];
+            gap = phases[i] - phases[i - 1];
+        }
+    }
+    return std::chrono::milliseconds{(start + (gap / 2)) % period};
+}
+
+auto JobScheduler::nextWakeup() const -> std::optional<Clock::time_point>
+{
+    auto result = std::optional<Clock::time_point>{};
+    for (const auto& [id, job]: this->jobMap) {
+        if (job.enabled && (!result || (job.next < *result))) {
+            result = job.next;
+        }
+    }
+    if (result) {
+        *result += this->slackTime;
+    }
+    return result;
+}
+
+auto JobScheduler::jobs() const -> std::vector<JobInfo>
+{
+    auto result = std::vector<JobInfo>{};
+    result.reserve(this->jobMap.size());
+    for (const auto& [id, job]: this->jobMap) {
+        result.push_back(JobInfo{
+            .id = id,
+            .name = job.name,
+            .interval = job.interval,
+            .next = job.next,
+            .enabled = job.enabled,
+            .inFlight = job.inFlight,
+            .runs = job.runs,
+            .skips = job.skips,
+        });
+    }
+    return result;
+}
+
+auto JobScheduler::wakeups() const noexcept -> int
+{
+    return this->wakeupCount;
+}
+
+void JobScheduler::wakeUp()
+{
+    ++(this->wakeupCount);
+    const auto now = Clock::now();
+    auto due = std::vector<JobId>{};
+    for (auto& [id, job]: this->jobMap) {
+        if (!job.enabled || (job.next > now)) {
+            continue;
+        }
+        // Stay in phase, skipping any periods that were missed.
+        const auto behind = (now - job.next) / job.interval;
+        job.next += job.interval * (behind + 1);
+        if (job.inFlight) {
+            ++(job.skips);
+            qDebug() << "JobScheduler skipping in flight job" << job.name;
+            continue;
+        }
+        due.push_back(id);
+    }
+    for (const auto id: due) {
+        // Earlier runs may have removed this job.
+        const auto it = this->jobMap.find(id);
+        if (it == this->jobMap.end()) {
+            continue;
+        }
+        it->second.inFlight = true;
+        ++(it->second.runs);
+        const auto run = it->second.run;
+        const auto started = run();
+        // The run may have removed the job, or finished it already.
+        const auto found = this->jobMap.find(id);
+        if ((found != this->jobMap.end()) && !started) {
+            found->second.inFlight = false;
+        }
+    }
+    this->arm();
+}
+
+void JobScheduler::arm()
+{
+    const auto wakeup = this->nextWakeup();
+    if (!wakeup) {
+        this->timer->stop();
+        return;
+    }
+    const auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(
+        *wakeup - Clock::now());
+    this->timer->start(std::max(delay, std::chrono::milliseconds{}));
+}
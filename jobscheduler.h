@@ -0,0 +1,124 @@
+#ifndef JOBSCHEDULER_H
+#define JOBSCHEDULER_H
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include <QObject>
+#include <QString>
+
+class QTimer;
+
+/// @brief Scheduler of periodic jobs on a single timer.
+/// @note Each job is due at its next run time, but may be run up to
+///   the slack later than that. Wakeups are put off till the earliest
+///   due job can wait no longer, & every job due by then is run in the
+///   same wakeup. So jobs of unrelated intervals share wakeups instead
+///   of each having their own, & jobs are never run early. A job whose
+///   previous run is still in flight is skipped till its next period.
+class JobScheduler : public QObject
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    using Clock = std::chrono::steady_clock;
+    using JobId = int;
+
+    /// @brief Runs a job.
+    /// @return Whether work was started that's to be ended by calling
+    ///   <code>finished</code> with the job's identifier.
+    using Run = std::function<bool()>;
+
+    static constexpr auto defaultSlack = std::chrono::milliseconds{500};
+
+    struct JobInfo {
+        JobId id{};
+        QString name;
+        std::chrono::milliseconds interval{};
+        Clock::time_point next;
+        bool enabled{};
+        bool inFlight{};
+        int runs{};
+        int skips{};
+    };
+
+    explicit JobScheduler(QObject *parent = nullptr);
+    ~JobScheduler() override;
+
+    [[nodiscard]] auto slack() const noexcept -> std::chrono::milliseconds;
+    void setSlack(std::chrono::milliseconds value);
+
+    /// @brief Adds a job that's next due after the given delay.
+    auto add(const QString& name,
+             std::chrono::milliseconds interval,
+             Run run,
+             std::chrono::milliseconds delay = {}) -> JobId;
+
+    void remove(JobId id);
+
+    /// @brief Changes the given job's interval.
+    /// @note Its next run is moved to be the new interval from its last.
+    void setInterval(JobId id, std::chrono::milliseconds value);
+
+    /// @brief Makes the given job next due after the given delay.
+    void runIn(JobId id, std::chrono::milliseconds delay);
+
+    /// @brief Enables or disables the given job.
+    /// @note A disabled job is kept but not run, nor woken up for.
+    void setEnabled(JobId id, bool value);
+
+    /// @brief Ends the in flight run of the given job.
+    void finished(JobId id);
+
+    /// @brief Next time the given job is due.
+    /// @return Time or no value if there's no such job, or it's disabled.
+    [[nodiscard]] auto nextRun(JobId id) const
+        -> std::optional<Clock::time_point>;
+
+    /// @brief Delay that puts a job of the given interval in the middle
+    ///   of the largest gap between the next runs of the given jobs.
+    /// @note For spreading the runs of like jobs evenly across their
+    ///   interval, instead of running them all at once.
+    /// @return Delay within the interval, or zero if none of the given
+    ///   jobs are enabled.
+    [[nodiscard]] auto staggeredDelay(const std::vector<JobId>& peers,
+                                      std::chrono::milliseconds interval) const
+        -> std::chrono::milliseconds;
+
+    /// @brief Time of the next wakeup, if any.
+    [[nodiscard]] auto nextWakeup() const -> std::optional<Clock::time_point>;
+
+    /// @brief Info on all the jobs, in the order they were added.
+    [[nodiscard]] auto jobs() const -> std::vector<JobInfo>;
+
+    /// @brief Number of wakeups so far.
+    [[nodiscard]] auto wakeups() const noexcept -> int;
+
+private:
+    struct Job {
+        QString name;
+        std::chrono::milliseconds interval{};
+        Run run;
+        Clock::time_point next;
+        bool enabled{true};
+        bool inFlight{};
+        int runs{};
+        int skips{};
+    };
+
+    void wakeUp();
+    void arm();
+
+    QTimer *timer{};
+    std::chrono::milliseconds slackTime{defaultSlack};
+    std::map<JobId, Job> jobMap;
+    JobId lastId{};
+    int wakeupCount{};
+};
+
+#endif // JOBSCHEDULER_H
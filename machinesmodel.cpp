@@ -0,0 +1,208 @@
+#include <QFontDatabase>
+
+#include "catalognames.h"
+#include "idsetstrings.h"
+#include "machinesmodel.h"
+#include "tablecolumndata.h"
+
+namespace {
+
+constexpr auto alignRight = Qt::AlignRight|Qt::AlignVCenter;
+
+}
+
+MachinesModel::MachinesModel(const BackupCatalog *catalog, QObject *parent):
+    CatalogTableModel{catalog, BackupCatalog::Table::Machines,
+                      MachinesColumn::count, parent},
+    fixedFont{QFontDatabase::systemFont(QFontDatabase::FixedFont)}
+{
+}
+
+auto MachinesModel::data(const QModelIndex &index, int role) const
+    -> QVariant
+{
+    if (!index.isValid()) {
+        return {};
+    }
+    if (role == SortRole) {
+        return toVariant(this->sortKey(index.row(), index.column()));
+    }
+    const auto& names = this->catalog().names();
+    const auto& row = this->catalog().machines()[index.row()];
+    switch (index.column()) {
+    case MachinesColumn::Name:
+        switch (role) {
+        case Qt::DisplayRole:
+            return names.machines.string(row.name);
+        case Qt::CheckStateRole:
+            return static_cast<int>(this->checkStates[index.row()]);
+        }
+        break;
+    case MachinesColumn::Uuid:
+        switch (role) {
+        case Qt::DisplayRole:
+            return row.uuid;
+        case Qt::FontRole:
+            return this->fixedFont;
+        }
+        break;
+    case MachinesColumn::Model:
+        if (role == Qt::DisplayRole) {
+            return row.model;
+        }
+        break;
+    case MachinesColumn::Address:
+        switch (role) {
+        case Qt::DisplayRole:
+            return row.address;
+        case Qt::FontRole:
+            return this->fixedFont;
+        }
+        break;
+    case MachinesColumn::Destinations:
+    case MachinesColumn::Volumes:
+    case MachinesColumn::Backups:
+    {
+        switch (role) {
+        case Qt::DisplayRole:
+            return qsizetype(
+                ((index.column() == MachinesColumn::Destinations)
+                     ? row.destinations
+                     : (index.column() == MachinesColumn::Volumes)
+                           ? row.volumes
+                           : row.backups).count());
+        case Qt::ToolTipRole:
+            switch (index.column()) {
+            case MachinesColumn::Destinations:
+                return toStringList(row.destinations, names.destinations,
+                                    maxToolTipStringList).join(", ");
+            case MachinesColumn::Volumes:
+                return toStringList(row.volumes, names.volumes,
+                                    maxToolTipStringList).join(", ");
+            }
+            return firstToLastToolTip(row.backups, names.backups);
+        case Qt::FontRole:
+            return this->fixedFont;
+        case Qt::TextAlignmentRole:
+            return QVariant::fromValue(alignRight);
+        }
+        return {};
+    }
+    }
+    if (role == Qt::TextAlignmentRole) {
+        return QVariant::fromValue(Qt::Alignment{Qt::AlignCenter});
+    }
+    return {};
+}
+
+auto MachinesModel::sortKey(int row, int column) const -> SortKey
+{
+    const auto& names = this->catalog().names();
+    const auto& entry = this->catalog().machines()[row];
+    switch (column) {
+    case MachinesColumn::Name:
+        return names.machines.string(entry.name);
+    case MachinesColumn::Uuid:
+        return entry.uuid;
+    case MachinesColumn::Model:
+        return entry.model;
+    case MachinesColumn::Address:
+        return entry.address;
+    case MachinesColumn::Destinations:
+        return qint64(entry.destinations.count());
+    case MachinesColumn::Volumes:
+        return qint64(entry.volumes.count());
+    case MachinesColumn::Backups:
+        return qint64(entry.backups.count());
+    }
+    return {};
+}
+
+auto MachinesModel::headerData(int section,
+                               Qt::Orientation orientation,
+                               int role) const -> QVariant
+{
+    static const auto columns = std::map<int, TableColumnData>{
+        {MachinesColumn::Name, {"Name", "Machine name."}},
+        {MachinesColumn::Uuid, {"UUID", "Universal unique ID of the named machine."}},
+        {MachinesColumn::Model, {"Model", "Model of the machine."}},
+        {MachinesColumn::Address, {"Address", "Primary MAC address of machine."}},
+        {MachinesColumn::Destinations,
+         {"Destinations",
+          "Number of destinations where backups for the machine can be found.",
+          Qt::AlignTrailing|Qt::AlignVCenter}},
+        {MachinesColumn::Volumes,
+         {"Volumes",
+          "Number of unique volumes in backups for the machines.",
+          Qt::AlignTrailing|Qt::AlignVCenter}},
+        {MachinesColumn::Backups,
+         {"Backups",
+          "Number of backups found for the machine.",
+          Qt::AlignTrailing|Qt::AlignVCenter}},
+    };
+    if (orientation != Qt::Horizontal) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+    return ::headerData(columns, section, role);
+}
+
+auto MachinesModel::flags(const QModelIndex &index) const
+    -> Qt::ItemFlags
+{
+    if (!index.isValid()) {
+        return Qt::NoItemFlags;
+    }
+    if (index.column() == MachinesColumn::Name) {
+        return Qt::ItemIsEnabled|Qt::ItemIsUserCheckable;
+    }
+    return Qt::ItemIsEnabled;
+}
+
+auto MachinesModel::setData(const QModelIndex &index,
+                            const QVariant &value,
+                            int role) -> bool
+{
+    if (!index.isValid() || (index.column() != MachinesColumn::Name) ||
+        (role != Qt::CheckStateRole)) {
+        return false;
+    }
+    auto& state = this->checkStates[index.row()];
+    const auto checked = static_cast<Qt::CheckState>(value.toInt());
+    if (state == checked) {
+        return true;
+    }
+    const auto wasChecked = (state != Qt::Unchecked);
+    state = checked;
+    emit dataChanged(index, index, {Qt::CheckStateRole});
+    if (wasChecked != (checked != Qt::Unchecked)) {
+        const auto name = this->catalog().machines()[index.row()].name;
+        auto& count = this->checkedCounts[name];
+        count += wasChecked? -1: +1;
+        if (count == (wasChecked? 0: 1)) {
+            emit checkedChanged(name, !wasChecked);
+        }
+    }
+    return true;
+}
+
+void MachinesModel::entriesInserted(int first, int last)
+{
+    this->checkStates.insert(this->checkStates.begin() + first,
+                             std::size_t(last - first + 1), Qt::Checked);
+    const auto& machines = this->catalog().machines();
+    for (auto i = first; i <= last; ++i) {
+        ++this->checkedCounts[machines[i].name];
+    }
+}
+
+void MachinesModel::entriesAboutToBeRemoved(int first, int last)
+{
+    const auto& machines = this->catalog().machines();
+    for (auto i = first; i <= last; ++i) {
+        if (this->checkStates[i] != Qt::Unchecked) {
+            --this->checkedCounts[machines[i].name];
+        }
+    }
+    this->checkStates.erase(this->checkStates.begin() + first,
+                            this->checkStates.begin() + last + 1);
+}
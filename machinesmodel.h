@@ -0,0 +1,69 @@
+#ifndef MACHINESMODEL_H
+#define MACHINESMODEL_H
+
+#include <vector>
+
+#include <QFont>
+#include <QHash>
+
+#include "catalogtablemodel.h"
+
+// A namespace scoped enum for the machines table columns...
+namespace MachinesColumn {
+enum Enum: int {
+    Name = 0,
+    Uuid,
+    Model,
+    Address,
+    Destinations,
+    Volumes,
+    Backups,
+};
+constexpr auto count = 7;
+}
+
+/// @brief Model for the machines table of a <code>BackupCatalog</code>.
+/// @note Only whether each row is checked is held by this model.
+class MachinesModel : public CatalogTableModel
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    explicit MachinesModel(const BackupCatalog *catalog,
+                           QObject *parent = nullptr);
+
+    [[nodiscard]] auto data(const QModelIndex &index,
+                            int role = Qt::DisplayRole) const
+        -> QVariant override;
+    [[nodiscard]] auto sortKey(int row, int column) const
+        -> SortKey override;
+    [[nodiscard]] auto headerData(int section,
+                                  Qt::Orientation orientation,
+                                  int role = Qt::DisplayRole) const
+        -> QVariant override;
+    [[nodiscard]] auto flags(const QModelIndex &index) const
+        -> Qt::ItemFlags override;
+    auto setData(const QModelIndex &index, const QVariant &value,
+                 int role = Qt::EditRole) -> bool override;
+
+signals:
+    /// @brief Signals when whether any row of the named machine is
+    ///   checked has changed.
+    void checkedChanged(NameId name, bool checked);
+
+protected:
+    void entriesInserted(int first, int last) override;
+    void entriesAboutToBeRemoved(int first, int last) override;
+
+private:
+    std::vector<Qt::CheckState> checkStates;
+
+    /// @brief Number of checked rows by name.
+    QHash<NameId, int> checkedCounts;
+
+    QFont fixedFont;
+};
+
+#endif // MACHINESMODEL_H
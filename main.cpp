@@ -1,10 +1,12 @@
+#include <chrono>
 #include <filesystem>
-#include <set>
+#include <memory>
 
 #include <QApplication>
 
+#include "directoryreader.h"
 #include "mainwindow.h"
-#include "seconds.h"
+#include "plist_object.h"
 
 auto main(int argc, char *argv[]) -> int
 {
@@ -17,14 +19,12 @@ auto main(int argc, char *argv[]) -> int
     // Allow some standard library types as QVariant...
     qRegisterMetaType<std::filesystem::path>();
     qRegisterMetaType<std::filesystem::file_status>();
+    qRegisterMetaType<std::filesystem::space_info>();
     qRegisterMetaType<std::error_code>();
-    qRegisterMetaType<std::chrono::seconds>();
-    qRegisterMetaType<std::set<QString>>();
-
-    QMetaType::registerConverter<std::chrono::seconds, QString>(
-        [](std::chrono::seconds value) {
-            return toString(value);
-        });
+    qRegisterMetaType<std::chrono::microseconds>();
+    qRegisterMetaType<std::shared_ptr<const plist_object>>();
+    qRegisterMetaType<DirectoryStamp>();
+    qRegisterMetaType<AttributeRecord>();
 
     MainWindow w;
     w.show();
@@ -1,22 +1,26 @@
 #ifndef MAINWINDOW_H
 #define MAINWINDOW_H
 
+#include <chrono>
 #include <filesystem>
 #include <map>
+#include <memory>
+#include <optional>
 
 #include <QFont>
 #include <QMainWindow>
-#include <QMap>
 #include <QPair>
+#include <QSet>
 #include <QString>
+#include <QStringList>
 #include <QVariant>
 #include <QErrorMessage>
 
+#include "jobscheduler.h"
+#include "statuspollpolicy.h"
 #include "plist_object.h"
 
-class QTableWidget;
-class QTableWidgetItem;
-class QThreadPool;
+class QTableView;
 class QTreeWidgetItem;
 class QTimer;
 class QMessageBox;
@@ -26,18 +30,16 @@ class QFrame;
 class QVBoxLayout;
 class QHBoxLayout;
 
+class BackupCatalog;
+class BackupsFilterModel;
+class BackupsModel;
+class CatalogScanner;
+class CatalogSortModel;
+class DestinationsModel;
+class MachinesModel;
 class PathActionDialog;
-class DirectoryReader;
-
-struct PathInfo {
-    std::filesystem::file_status status;
-    QMap<QString, QByteArray> attributes;
-};
-
-struct MachineInfo {
-    QMap<QString, QByteArray> attributes;
-    QSet<QString> destinations;
-};
+class SpaceQueries;
+class VolumesModel;
 
 class MainWindow : public QMainWindow
 {
@@ -52,30 +54,20 @@ public:
     void closeEvent(QCloseEvent *event) override;
 
     void readSettings();
-    void updateMountPointsView(
-        const std::map<std::string, plist_dict>& mountPoints);
+
+    /// @brief Populates the catalog from what was cached when last run
+    ///   for each of its destinations not read from the cache yet.
+    /// @note Scans that follow revalidate this, signaling only changes.
+    void readCatalogCache();
+    void updateMountPointsView();
     void deleteSelectedBackups();
     void uniqueSizeSelectedPaths();
     void restoreSelectedPaths();
     void verifySelectedBackups();
     void showAboutDialog();
     void showSettingsDialog();
-    void handleDirectoryReaderEnded(
-        const std::filesystem::path& dir,
-        std::error_code ec,
-        const QSet<QString>& filenames);
-    void reportDir(const std::filesystem::path& dir,
-                   const QSet<QString>& filenames);
-    void handleDirectoryReaderEntry(const std::filesystem::path& path,
-                        const std::filesystem::file_status& status,
-                        const QMap<QString, QByteArray>& attrs);
-    void updateMachines(const std::string& name,
-                       const QMap<QString, QByteArray>& attrs,
-                       const plist_dict& dict);
-    void updateBackups(const std::filesystem::path& path,
-                       const QMap<QString, QByteArray>& attrs);
-    void updateVolumes(const std::filesystem::path& path,
-                       const QMap<QString, QByteArray>& attrs);
+    void handleReadFailed(const std::filesystem::path& dir,
+                          std::error_code ec);
     void checkTmStatus();
     void checkTmDestinations();
     void showStatus(const QString& status);
@@ -95,16 +87,21 @@ private:
     void handleSudoPathChange(const QString &path);
 
     void handleGotDestinations(
-        const std::vector<plist_dict>& destinations);
-    void handleGotDestinations(const plist_array &plist);
-    void handleGotDestinations(const plist_dict &plist);
-    void handleTmDestinations(const plist_object &plist);
+        const std::vector<plist_ptr<plist_dict>>& destinations);
+    void handleGotDestinations(const plist_ptr<plist_array> &plist);
+    void handleGotDestinations(const plist_ptr<plist_dict> &plist);
+    void handleGotSpace(const QString& path,
+                        const std::filesystem::space_info& info,
+                        std::error_code ec);
+    void handleTmDestinations(
+        const std::shared_ptr<const plist_object> &plist);
     void handleTmDestinationsError(int error, const QString &text);
     void handleTmDestinationsReaderError(qint64 lineNumber,
                                          int error,
                                          const QString& text);
 
-    void handleTmStatus(const plist_object &plist);
+    void handleTmStatus(
+        const std::shared_ptr<const plist_object> &plist);
     void handleTmStatusNoPlist();
     void handleTmStatusReaderError(qint64 lineNumber,
                                    int error,
@@ -117,24 +114,29 @@ private:
     void handleDestinationAction(const QString& actionName,
                                  const std::string& destId);
 
-    void handleItemChanged(QTableWidgetItem *item);
+    [[nodiscard]] auto selectedBackupPaths() const -> QStringList;
     void handleRestoreSelectedPathsChanged(
         PathActionDialog *dialog,
         const QStringList& paths);
     void changeTmutilStatusInterval(int msecs);
     void changeTmutilDestinationsInterval(int msecs);
     void changePathInfoInterval(int msecs);
-    void updateMountPointPaths();
-    void updatePathInfo(const std::string& pathName);
-    void updateStorageDir(const std::filesystem::path& dir,
-                          const QSet<QString>& filenames);
-    void updateMachineDir(const std::filesystem::path& dir,
-                          const QSet<QString>& filenames);
-    void updateVolumeDir(const std::filesystem::path& dir,
-                         const QSet<QString>& filenames);
-
-    /// @brief Thread pool just for directory reading.
-    QThreadPool *directoryReaderThreadPool;
+    void changePathInfoGenerations(int value);
+    void changeSchedulerSlack(int msecs);
+
+    /// @brief Adds & removes the space query jobs of destinations to
+    ///   match the mount points.
+    /// @note The job of a destination that's added is staggered from
+    ///   those of the others, so their runs are spread over the interval.
+    void updateSpaceJobs();
+
+    /// @brief Prioritizes reading the volumes of the backups that are
+    ///   visible or selected in the backups table.
+    void prioritizeShownBackups();
+
+    /// @brief Schedules applying staged table updates, at most once a frame.
+    void scheduleTableUpdates();
+    void applyTableUpdates();
 
     QAction *actionAbout;
     QAction *actionQuit;
@@ -143,19 +145,19 @@ private:
     QFrame *destinationsFrame;
     QVBoxLayout *destinationsLayout;
     QLabel *destinationsLabel;
-    QTableWidget *destinationsTable;
+    QTableView *destinationsTable;
     QFrame *machinesFrame;
     QVBoxLayout *machinesLayout;
-    QTableWidget *machinesTable;
+    QTableView *machinesTable;
     QLabel *machinesLabel;
     QFrame *volumesFrame;
     QVBoxLayout *volumesLayout;
     QLabel *volumesLabel;
-    QTableWidget *volumesTable;
+    QTableView *volumesTable;
     QFrame *backupsFrame;
     QVBoxLayout *backupsLayout;
     QLabel *backupsLabel;
-    QTableWidget *backupsTable;
+    QTableView *backupsTable;
     QFrame *backupsActionsFrame;
     QHBoxLayout *backupsActionsLayout;
     QPushButton *deletingPushButton;
@@ -166,20 +168,42 @@ private:
     QMenu *menuActions;
     QStatusBar *statusbar;
     QToolBar *toolBar;
+    BackupCatalog *catalog;
+    DestinationsModel *destinationsModel;
+    CatalogSortModel *destinationsProxy;
+    MachinesModel *machinesModel;
+    CatalogSortModel *machinesProxy;
+    VolumesModel *volumesModel;
+    CatalogSortModel *volumesProxy;
+    BackupsModel *backupsModel;
+    BackupsFilterModel *backupsProxy;
+    SpaceQueries *spaceQueries;
 
     QErrorMessage errorMessage;
     QMessageBox *noDestinationsDialog{};
-    QTimer *destinationsTimer{};
-    QTimer *statusTimer{};
-    QTimer *pathInfoTimer{};
+    QTimer *tableUpdatesTimer{};
+
+    /// @brief Scheduler of all periodic polls, scans, & queries.
+    JobScheduler *scheduler{};
+    JobScheduler::JobId statusJob{};
+    JobScheduler::JobId destinationsJob{};
+    CatalogScanner *scanner{};
+
+    /// @brief Space query jobs of each destination, by mount point.
+    std::map<std::string, JobScheduler::JobId> spaceJobs;
+
     QString tmutilPath;
     QString sudoPath;
-    QFont fixedFont;
-    std::map<std::string, plist_dict> mountMap;
-    std::map<QString, MachineInfo> machineMap;
-    std::map<std::filesystem::path, PathInfo> pathInfoMap;
-    std::map<std::string, DirectoryReader*> directoryReaders;
-    plist_dict lastStatus;
+    plist_ptr<plist_dict> lastStatus;
+    StatusPollPolicy statusPollPolicy;
+    /// @brief Whether destinations have been polled successfully.
+    bool destinationsPolled{};
+    /// @brief Identifiers of the destinations whose cache files have
+    ///   been read.
+    QSet<QString> cacheRead;
+    /// @brief Whether the output of the status poll in flight couldn't
+    ///   be used, so the poll's counted as failed when it finishes.
+    bool statusPollFailed{};
 };
 
 #endif // MAINWINDOW_H
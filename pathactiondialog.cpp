@@ -677,7 +677,7 @@ void PathActionDialog::changePathSelection()
 void PathActionDialog::handleReaderEntry(
     const std::filesystem::path &path,
     const std::filesystem::file_status &status,
-    const QMap<QString, QByteArray> &)
+    const AttributeRecord &)
 {
     using QTreeWidgetItem::ChildIndicatorPolicy::ShowIndicator;
     using QTreeWidgetItem::ChildIndicatorPolicy::DontShowIndicator;
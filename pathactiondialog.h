@@ -7,6 +7,8 @@
 #include <QStringList>
 #include <QProcessEnvironment>
 
+#include "attributerecord.h"
+
 class QTextEdit;
 class QLabel;
 class QPushButton;
@@ -89,7 +91,7 @@ private:
     void handleErrorOccurred(int error);
     void handleReaderEntry(const std::filesystem::path& path,
                            const std::filesystem::file_status& status,
-                           const QMap<QString, QByteArray>& attrs);
+                           const AttributeRecord& record);
     void stop();
     void terminate();
     void kill();
@@ -0,0 +1,228 @@
+#ifndef PATHTRIE_H
+#define PATHTRIE_H
+
+#include <cstddef> // for std::size_t
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <utility> // for std::as_const
+#include <vector>
+
+#include <QHash>
+#include <QString>
+
+#include "stringinterner.h"
+
+/// @brief Tree of values keyed by path, with a node per path component.
+/// @note Path components are interned, so nodes only hold identifiers
+///   of their components & looking up a path costs one hash lookup per
+///   component, independent of how many paths are held. Nodes are
+///   referred to by handles that stay valid as other nodes are added
+///   or dropped. A dropped node's handle may be reused by a node added
+///   later, so holders of handles should check what they refer to
+///   when a node could have been dropped since. Whole subtrees are
+///   dropped at once, like when a destination goes away.
+template <class T>
+class PathTrie
+{
+public:
+    using Handle = std::uint32_t;
+
+    /// @brief Handle of the node for the empty path.
+    static constexpr auto root = Handle{0};
+
+    PathTrie(): nodes(1u) {}
+
+    /// @brief Finds the node of the given path.
+    [[nodiscard]] auto find(const std::filesystem::path& path) const
+        -> std::optional<Handle>
+    {
+        auto handle = root;
+        for (const auto& element: path) {
+            const auto id = this->components.find(
+                QString::fromStdString(element.string()));
+            if (!id) {
+                return {};
+            }
+            const auto& children = this->nodes[handle].children;
+            const auto it = children.constFind(*id);
+            if (it == children.constEnd()) {
+                return {};
+            }
+            handle = *it;
+        }
+        return handle;
+    }
+
+    /// @brief Gets the node of the given path, adding nodes as needed.
+    auto insert(const std::filesystem::path& path) -> Handle
+    {
+        auto handle = root;
+        for (const auto& element: path) {
+            const auto id = this->components.intern(
+                QString::fromStdString(element.string()));
+            const auto it = this->nodes[handle].children.constFind(id);
+            handle = (it != this->nodes[handle].children.constEnd())
+                ? *it
+                : this->add(handle, id);
+        }
+        return handle;
+    }
+
+    /// @brief Whether the given handle is that of a node held.
+    [[nodiscard]] auto contains(Handle handle) const noexcept -> bool
+    {
+        return (handle < this->nodes.size()) && this->nodes[handle].held;
+    }
+
+    /// @brief Gets the value of the given node.
+    /// @note The reference is invalidated by adding nodes.
+    [[nodiscard]] auto value(Handle handle) -> T&
+    {
+        return this->nodes[handle].value;
+    }
+
+    [[nodiscard]] auto value(Handle handle) const -> const T&
+    {
+        return this->nodes[handle].value;
+    }
+
+    /// @brief Gets the node of the parent directory of the given node.
+    /// @return Handle of the parent or no value for the root.
+    [[nodiscard]] auto parent(Handle handle) const -> std::optional<Handle>
+    {
+        if (handle == root) {
+            return {};
+        }
+        return this->nodes[handle].parent;
+    }
+
+    /// @brief Gets the path of the given node.
+    [[nodiscard]] auto path(Handle handle) const -> std::filesystem::path
+    {
+        auto ids = std::vector<NameId>{};
+        for (; handle != root; handle = this->nodes[handle].parent) {
+            ids.push_back(this->nodes[handle].component);
+        }
+        auto result = std::filesystem::path{};
+        for (auto it = ids.rbegin(); it != ids.rend(); ++it) {
+            result /= this->components.string(*it).toStdString();
+        }
+        return result;
+    }
+
+    /// @brief Drops the given node & everything below it.
+    /// @note Dropping the root only drops its value & what's below it.
+    void erase(Handle handle)
+    {
+        if (!this->contains(handle)) {
+            return;
+        }
+        if (handle != root) {
+            auto& node = this->nodes[handle];
+            this->nodes[node.parent].children.remove(node.component);
+        }
+        auto pending = std::vector<Handle>{handle};
+        while (!pending.empty()) {
+            const auto current = pending.back();
+            pending.pop_back();
+            auto& node = this->nodes[current];
+            for (const auto child: std::as_const(node.children)) {
+                pending.push_back(child);
+            }
+            node.children.clear();
+            node.value = T{};
+            if (current != root) {
+                node.held = false;
+                this->unused.push_back(current);
+            }
+        }
+    }
+
+    /// @brief Drops each largest subtree of nodes whose values are all
+    ///   stale according to the given predicate.
+    /// @note A node that's not stale keeps the nodes above it, so the
+    ///   paths of the nodes kept stay whole. The root is never dropped.
+    /// @return Number of nodes dropped.
+    template <class Predicate>
+    auto prune(Predicate stale) -> std::size_t
+    {
+        const auto before = this->size();
+        (void) this->pruneBelow(root, stale);
+        return before - this->size();
+    }
+
+    /// @brief Number of nodes held, including the root.
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+        return this->nodes.size() - this->unused.size();
+    }
+
+    /// @brief Approximate number of bytes used by the nodes held.
+    /// @note This doesn't count memory that values refer to, nor the
+    ///   interned components, which are kept for reuse.
+    [[nodiscard]] auto bytesUsed() const noexcept -> std::size_t
+    {
+        const auto entryBytes = sizeof(NameId) + sizeof(Handle);
+        auto result = this->size() * sizeof(Node);
+        for (const auto& node: this->nodes) {
+            result += node.held? (node.children.size() * entryBytes): 0u;
+        }
+        return result;
+    }
+
+private:
+    struct Node {
+        Handle parent{};
+        NameId component{};
+        bool held{true};
+        QHash<NameId, Handle> children;
+        T value{};
+    };
+
+    auto add(Handle parent, NameId component) -> Handle
+    {
+        auto handle = Handle{};
+        if (!this->unused.empty()) {
+            handle = this->unused.back();
+            this->unused.pop_back();
+            this->nodes[handle] = Node{parent, component};
+        }
+        else {
+            handle = static_cast<Handle>(this->nodes.size());
+            this->nodes.push_back(Node{parent, component});
+        }
+        this->nodes[parent].children.insert(component, handle);
+        return handle;
+    }
+
+    /// @return Whether the whole subtree of the given node is stale.
+    template <class Predicate>
+    auto pruneBelow(Handle handle, Predicate& stale) -> bool
+    {
+        auto staleChildren = std::vector<Handle>{};
+        auto allStale = true;
+        for (const auto child: std::as_const(this->nodes[handle].children)) {
+            if (this->pruneBelow(child, stale)) {
+                staleChildren.push_back(child);
+            }
+            else {
+                allStale = false;
+            }
+        }
+        if (allStale && (handle != root) &&
+            stale(std::as_const(this->nodes[handle].value))) {
+            return true; // Leave it to the parent to drop all at once.
+        }
+        for (const auto child: staleChildren) {
+            this->erase(child);
+        }
+        return false;
+    }
+
+    StringInterner components;
+    std::vector<Node> nodes;
+    std::vector<Handle> unused;
+};
+
+#endif // PATHTRIE_H
@@ -1,6 +1,8 @@
 #ifndef PLIST_BUILDER_H
 #define PLIST_BUILDER_H
 
+#include <stdexcept> // for std::invalid_argument
+
 #include "coroutine.h"
 
 #include "plist_object.h"
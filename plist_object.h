@@ -4,6 +4,7 @@
 #include <chrono>
 #include <cstdint> // for std::int64_t
 #include <map>
+#include <memory>
 #include <optional>
 #include <string>
 #include <type_traits> // for std::true_type, std::false_type
@@ -58,8 +59,18 @@ struct plist_object {
     {
         return value.index() != 0;
     }
+
+    friend auto operator==(const plist_object& lhs,
+                           const plist_object& rhs) -> bool = default;
 };
 
+/// @brief Shared immutable handle to a plist value.
+/// @note Handles to sub-trees are made with the aliasing constructor
+///   of <code>std::shared_ptr</code> so they keep the whole document
+///   alive without copying any of it.
+template <class T>
+using plist_ptr = std::shared_ptr<const T>;
+
 template <class T>
 auto get(const plist_dict& map, const plist_string& key)
     -> std::optional<T>
@@ -72,4 +83,36 @@ auto get(const plist_dict& map, const plist_string& key)
     return {};
 }
 
+/// @brief Gets a handle to the given object's value if it's a @c T.
+/// @return Non-null handle sharing ownership with @c object if
+///   @c object holds a @c T, null handle otherwise.
+template <class T>
+auto get_ptr(const plist_ptr<plist_object>& object)
+    -> plist_ptr<T>
+{
+    if (object) {
+        if (const auto p = std::get_if<T>(&object->value)) {
+            return {object, p};
+        }
+    }
+    return {};
+}
+
+/// @brief Gets a handle to the @c T value of the given key's entry.
+/// @return Non-null handle sharing ownership with @c map if the
+///   entry exists and holds a @c T, null handle otherwise.
+template <class T>
+auto get_ptr(const plist_ptr<plist_dict>& map, const plist_string& key)
+    -> plist_ptr<T>
+{
+    if (map) {
+        if (const auto it = map->find(key); it != map->end()) {
+            if (const auto p = std::get_if<T>(&it->second.value)) {
+                return {map, p};
+            }
+        }
+    }
+    return {};
+}
+
 #endif // PLIST_OBJECT_H
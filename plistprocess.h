@@ -1,18 +1,14 @@
 #ifndef PLISTPROCESS_H
 #define PLISTPROCESS_H
 
-#include <optional>
+#include <memory>
 
 #include <QObject>
 #include <QString>
 #include <QStringList>
 
-#include "coroutine.h"
 #include "plist_object.h"
 
-class QProcess;
-class QXmlStreamReader;
-
 class PlistProcess : public QObject
 {
     // NOLINTBEGIN
@@ -22,9 +18,13 @@ class PlistProcess : public QObject
 public:
     explicit PlistProcess(QObject *parent = nullptr);
 
-    [[nodiscard]] auto plist() const -> std::optional<plist_object>;
+    [[nodiscard]] auto plist() const
+        -> std::shared_ptr<const plist_object>;
 
     /// @brief Start specified program with given arguments.
+    /// @note The program's output is read and parsed within a
+    ///   worker thread shared by all instances of this class. Only
+    ///   the finished plist is handed back to this object's thread.
     /// @post <code>errorOccurred(int, const QString&)</code> will
     ///   be emitted with the first argument of
     ///   <code>QProcess::FailedToStart</code>, or
@@ -35,8 +35,9 @@ public:
 signals:
     /// @brief Got the "plist".
     /// @note Emitted when the reader has finished parsing a "plist".
+    /// @param plist Shared immutable plist. Never null.
     /// @post Finally, <code>finished</code> will be emitted.
-    void gotPlist(const plist_object& plist);
+    void gotPlist(const std::shared_ptr<const plist_object>& plist);
 
     /// @brief Got no "plist".
     /// @note Emitted when the reader has finished without a "plist".
@@ -79,17 +80,9 @@ signals:
                   int status);
 
 private:
-    void handleStarted();
-    void handleErrorOccurred(int error);
-    void handleProcessFinished(int code, int status);
-    void readMore();
-
-    std::optional<plist_object> data;
-    QProcess *process{};
-    QXmlStreamReader *reader{};
-    await_handle<plist_variant> awaitable;
-    coroutine_task<plist_object> task;
-    QString currentText;
+    void handleGotPlist(const std::shared_ptr<const plist_object>& plist);
+
+    std::shared_ptr<const plist_object> data;
 };
 
 #endif // PLISTPROCESS_H
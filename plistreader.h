@@ -0,0 +1,62 @@
+#ifndef PLISTREADER_H
+#define PLISTREADER_H
+
+#include <memory>
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QXmlStreamReader>
+
+#include "coroutine.h"
+#include "plist_object.h"
+
+class QProcess;
+
+/// @brief Reader of a "plist" from the output of a process.
+/// @note This is the worker side of <code>PlistProcess</code>. It
+///   runs the process, tokenizes its output, and resumes the plist
+///   builder coroutines all within the thread that it lives in. Only
+///   the finished plist crosses back to other threads.
+class PlistReader : public QObject
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    explicit PlistReader(QObject *parent = nullptr);
+    ~PlistReader() override;
+
+    /// @brief Start specified program with given arguments.
+    /// @note Call this from the thread this object lives in.
+    void start(const QString& program,
+               const QStringList& args = {});
+
+signals:
+    void started();
+    void gotPlist(const std::shared_ptr<const plist_object>& plist);
+    void gotNoPlist();
+    void errorOccurred(int error, const QString& text);
+    void gotReaderError(qint64 lineNumber,
+                        int error,
+                        const QString& text);
+    void finished(const QString& program,
+                  const QStringList& arguments,
+                  int code,
+                  int status);
+
+private:
+    void handleErrorOccurred(int error);
+    void handleProcessFinished(int code, int status);
+    void readMore();
+
+    std::shared_ptr<const plist_object> data;
+    QProcess *process{};
+    QXmlStreamReader reader;
+    await_handle<plist_variant> awaitable;
+    coroutine_task<plist_object> task;
+    QString currentText;
+};
+
+#endif // PLISTREADER_H
@@ -3,11 +3,8 @@
 
 #include <chrono>
 
-#include <QMetaType>
 #include <QString>
 
-Q_DECLARE_METATYPE(std::chrono::seconds); // NOLINT(modernize-use-trailing-return-type)
-
 auto toString(std::chrono::seconds value) -> QString;
 
 #endif // SECONDS_H
@@ -10,6 +10,8 @@ constexpr auto tmutilStatTimeKey = "tmutilStatusInterval";
 constexpr auto tmutilDestTimeKey = "tmutilDestinationsInterval";
 constexpr auto sudoPathKey = "sudoPath";
 constexpr auto pathInfoTimeKey = "pathInfoInterval";
+constexpr auto pathInfoGensKey = "pathInfoGenerations";
+constexpr auto schedulerSlackKey = "schedulerSlack";
 constexpr auto mainWindowGeomKey = "mainWindowGeomtry";
 constexpr auto mainWindowStateKey = "mainWindowState";
 constexpr auto centralWidgetStateKey = "centralWidgetState";
@@ -56,6 +58,18 @@ auto defaultPathInfoInterval() -> int
     return value;
 }
 
+auto defaultPathInfoGenerations() -> int
+{
+    static constexpr auto value = 3;
+    return value;
+}
+
+auto defaultSchedulerSlack() -> int
+{
+    static constexpr auto value = 500;
+    return value;
+}
+
 auto tmutilPath() -> QString
 {
     return settings()
@@ -96,6 +110,22 @@ auto pathInfoInterval() -> int
         .toInt();
 }
 
+auto pathInfoGenerations() -> int
+{
+    return settings()
+        .value(pathInfoGensKey,
+               QVariant::fromValue(defaultPathInfoGenerations()))
+        .toInt();
+}
+
+auto schedulerSlack() -> int
+{
+    return settings()
+        .value(schedulerSlackKey,
+               QVariant::fromValue(defaultSchedulerSlack()))
+        .toInt();
+}
+
 auto mainWindowGeometry() -> QByteArray
 {
     return settings().value(mainWindowGeomKey).toByteArray();
@@ -156,6 +186,16 @@ void setPathInfoInterval(int value)
     settings().setValue(pathInfoTimeKey, value);
 }
 
+void setPathInfoGenerations(int value)
+{
+    settings().setValue(pathInfoGensKey, value);
+}
+
+void setSchedulerSlack(int value)
+{
+    settings().setValue(schedulerSlackKey, value);
+}
+
 void setMainWindowGeometry(const QByteArray &value)
 {
     settings().setValue(mainWindowGeomKey, value);
@@ -11,6 +11,8 @@ auto defaultSudoPath() -> QString;
 auto defaultTmutilStatInterval() -> int;
 auto defaultTmutilDestInterval() -> int;
 auto defaultPathInfoInterval() -> int;
+auto defaultPathInfoGenerations() -> int;
+auto defaultSchedulerSlack() -> int;
 
 auto tmutilPath() -> QString;
 auto sudoPath() -> QString;
@@ -18,6 +20,14 @@ auto tmutilStatInterval() -> int;
 auto tmutilDestInterval() -> int;
 auto pathInfoInterval() -> int;
 
+/// @brief Number of scan passes that a path's info is kept for after
+///   the path was last seen.
+auto pathInfoGenerations() -> int;
+
+/// @brief Milliseconds that periodic jobs may be put off by, so that
+///   they share wakeups.
+auto schedulerSlack() -> int;
+
 auto mainWindowGeometry() -> QByteArray;
 auto mainWindowState() -> QByteArray;
 auto centralWidgetState() -> QByteArray;
@@ -31,6 +41,8 @@ void setTmutilStatInterval(int value);
 void setTmutilDestInterval(int value);
 void setSudoPath(const QString& value);
 void setPathInfoInterval(int value);
+void setPathInfoGenerations(int value);
+void setSchedulerSlack(int value);
 
 void setMainWindowGeometry(const QByteArray& value);
 void setMainWindowState(const QByteArray& value);
@@ -19,6 +19,12 @@ constexpr auto minimumTimeMsecs = 250;
 constexpr auto maximumTimeMsecs = 60000;
 constexpr auto timeStepMsecs = 250;
 
+constexpr auto minimumSlackMsecs = 0;
+constexpr auto maximumSlackMsecs = 10000;
+
+constexpr auto minimumGenerations = 1;
+constexpr auto maximumGenerations = 100;
+
 constexpr auto badValueStyle = "background-color: rgb(255, 170, 170);";
 constexpr auto goodValueStyle = "background-color: rgb(170, 255, 170);";
 
@@ -100,6 +106,12 @@ auto SettingsDialog::anyNonDefault() -> bool
     if (pathInfoInterval() != defaultPathInfoInterval()) {
         return true;
     }
+    if (pathInfoGenerations() != defaultPathInfoGenerations()) {
+        return true;
+    }
+    if (schedulerSlack() != defaultSchedulerSlack()) {
+        return true;
+    }
     return false;
 }
 
@@ -120,6 +132,10 @@ SettingsDialog::SettingsDialog(QWidget *parent):
     sudoPathBtn{new QPushButton{this}},
     pathInfoTimeLbl{new QLabel{this}},
     pathInfoTimeEdit{new QSpinBox{this}},
+    pathInfoGensLbl{new QLabel{this}},
+    pathInfoGensEdit{new QSpinBox{this}},
+    slackTimeLbl{new QLabel{this}},
+    slackTimeEdit{new QSpinBox{this}},
     exePathValidator{new ExecutableValidator{this}}
 {
     this->setAttribute(Qt::WA_DeleteOnClose);
@@ -167,6 +183,18 @@ SettingsDialog::SettingsDialog(QWidget *parent):
     this->pathInfoTimeEdit->setAlignment(Qt::AlignRight);
     this->origPathInfoTimeStyle = this->pathInfoTimeEdit->styleSheet();
 
+    this->pathInfoGensLbl->setText(tr("Path Info Generations"));
+    this->pathInfoGensEdit->setRange(minimumGenerations, maximumGenerations);
+    this->pathInfoGensEdit->setAlignment(Qt::AlignRight);
+    this->origPathInfoGensStyle = this->pathInfoGensEdit->styleSheet();
+
+    this->slackTimeLbl->setText(tr("Scheduler Slack"));
+    this->slackTimeEdit->setRange(minimumSlackMsecs, maximumSlackMsecs);
+    this->slackTimeEdit->setSingleStep(timeStepMsecs);
+    this->slackTimeEdit->setSuffix(" ms");
+    this->slackTimeEdit->setAlignment(Qt::AlignRight);
+    this->origSlackTimeStyle = this->slackTimeEdit->styleSheet();
+
     this->setLayout([this]() {
         auto *mainLayout = new QVBoxLayout;
         mainLayout->addLayout([this]() {
@@ -189,6 +217,12 @@ SettingsDialog::SettingsDialog(QWidget *parent):
             ++row;
             layout->addWidget(this->pathInfoTimeLbl, row, 0);
             layout->addWidget(this->pathInfoTimeEdit, row, 1);
+            ++row;
+            layout->addWidget(this->pathInfoGensLbl, row, 0);
+            layout->addWidget(this->pathInfoGensEdit, row, 1);
+            ++row;
+            layout->addWidget(this->slackTimeLbl, row, 0);
+            layout->addWidget(this->slackTimeEdit, row, 1);
             return layout;
         }());
         mainLayout->addLayout([this]() {
@@ -229,12 +263,18 @@ SettingsDialog::SettingsDialog(QWidget *parent):
             this, &SettingsDialog::handleDestTimeChanged);
     connect(this->pathInfoTimeEdit, &QSpinBox::valueChanged,
             this, &SettingsDialog::handlePathInfoTimeChanged);
+    connect(this->pathInfoGensEdit, &QSpinBox::valueChanged,
+            this, &SettingsDialog::handlePathInfoGensChanged);
+    connect(this->slackTimeEdit, &QSpinBox::valueChanged,
+            this, &SettingsDialog::handleSlackTimeChanged);
 
     this->tmutilPathEdit->setText(tmutilPath());
     this->tmutilStatTimeEdit->setValue(tmutilStatInterval());
     this->tmutilDestTimeEdit->setValue(tmutilDestInterval());
     this->sudoPathEdit->setText(sudoPath());
     this->pathInfoTimeEdit->setValue(pathInfoInterval());
+    this->pathInfoGensEdit->setValue(pathInfoGenerations());
+    this->slackTimeEdit->setValue(schedulerSlack());
 
     this->saveButton->setEnabled(false);
     this->resetButton->setEnabled(anyNonDefault());
@@ -276,6 +316,12 @@ auto SettingsDialog::allAcceptable() const -> bool
     if (!this->pathInfoTimeEdit->hasAcceptableInput()) {
         return false;
     }
+    if (!this->pathInfoGensEdit->hasAcceptableInput()) {
+        return false;
+    }
+    if (!this->slackTimeEdit->hasAcceptableInput()) {
+        return false;
+    }
     return true;
 }
 
@@ -296,6 +342,12 @@ auto SettingsDialog::anyChanged() const -> bool
     if (pathInfoInterval() != this->pathInfoTimeEdit->value()) {
         return true;
     }
+    if (pathInfoGenerations() != this->pathInfoGensEdit->value()) {
+        return true;
+    }
+    if (schedulerSlack() != this->slackTimeEdit->value()) {
+        return true;
+    }
     return false;
 }
 
@@ -406,6 +458,32 @@ void SettingsDialog::handlePathInfoTimeChanged(int value)
     this->pathInfoTimeEdit->setStyleSheet(styleSheet);
 }
 
+void SettingsDialog::handlePathInfoGensChanged(int value)
+{
+    qDebug() << "SettingsDialog::handlePathInfoGensChanged called"
+             << value;
+    this->closeButton->setEnabled(allAcceptable() && !anyChanged());
+    this->saveButton->setEnabled(allAcceptable() && anyChanged());
+    const auto changed = pathInfoGenerations() != value;
+    const auto styleSheet = changed
+                                ? QString(goodValueStyle)
+                                : this->origPathInfoGensStyle;
+    this->pathInfoGensEdit->setStyleSheet(styleSheet);
+}
+
+void SettingsDialog::handleSlackTimeChanged(int value)
+{
+    qDebug() << "SettingsDialog::handleSlackTimeChanged called"
+             << value;
+    this->closeButton->setEnabled(allAcceptable() && !anyChanged());
+    this->saveButton->setEnabled(allAcceptable() && anyChanged());
+    const auto changed = schedulerSlack() != value;
+    const auto styleSheet = changed
+                                ? QString(goodValueStyle)
+                                : this->origSlackTimeStyle;
+    this->slackTimeEdit->setStyleSheet(styleSheet);
+}
+
 void SettingsDialog::save()
 {
     if (!allAcceptable()) {
@@ -459,6 +537,24 @@ void SettingsDialog::save()
             emit pathInfoIntervalChanged(newValue);
         }
     }
+    {
+        const auto oldValue = pathInfoGenerations();
+        const auto newValue = this->pathInfoGensEdit->value();
+        this->pathInfoGensEdit->setStyleSheet(this->origPathInfoGensStyle);
+        if (oldValue != newValue) {
+            setPathInfoGenerations(newValue);
+            emit pathInfoGenerationsChanged(newValue);
+        }
+    }
+    {
+        const auto oldValue = schedulerSlack();
+        const auto newValue = this->slackTimeEdit->value();
+        this->slackTimeEdit->setStyleSheet(this->origSlackTimeStyle);
+        if (oldValue != newValue) {
+            setSchedulerSlack(newValue);
+            emit schedulerSlackChanged(newValue);
+        }
+    }
     this->saveButton->setEnabled(false);
     this->resetButton->setEnabled(anyNonDefault());
     this->accept();
@@ -471,6 +567,8 @@ void SettingsDialog::reset()
     const auto oldTmutilStatTime = tmutilStatInterval();
     const auto oldTmutilDestTime = tmutilDestInterval();
     const auto oldPathInfoTime = pathInfoInterval();
+    const auto oldPathInfoGens = pathInfoGenerations();
+    const auto oldSlackTime = schedulerSlack();
     clear();
     if (const auto newVal = tmutilPath();
         oldTmutilPath != newVal) {
@@ -492,6 +590,14 @@ void SettingsDialog::reset()
         oldPathInfoTime != newVal) {
         emit pathInfoIntervalChanged(newVal);
     }
+    if (const auto newVal = pathInfoGenerations();
+        oldPathInfoGens != newVal) {
+        emit pathInfoGenerationsChanged(newVal);
+    }
+    if (const auto newVal = schedulerSlack();
+        oldSlackTime != newVal) {
+        emit schedulerSlackChanged(newVal);
+    }
     emit allReset();
     this->saveButton->setEnabled(false);
     this->resetButton->setEnabled(false);
@@ -33,6 +33,8 @@ signals:
     void tmutilStatusIntervalChanged(int newMsecs);
     void tmutilDestinationsIntervalChanged(int newMsecs);
     void pathInfoIntervalChanged(int newMsecs);
+    void pathInfoGenerationsChanged(int newValue);
+    void schedulerSlackChanged(int newMsecs);
     void allReset();
 
 private:
@@ -45,6 +47,8 @@ private:
     void handleStatTimeChanged(int value);
     void handleDestTimeChanged(int value);
     void handlePathInfoTimeChanged(int value);
+    void handlePathInfoGensChanged(int value);
+    void handleSlackTimeChanged(int value);
     void save();
     void reset();
 
@@ -74,6 +78,14 @@ private:
     QLabel *pathInfoTimeLbl{};
     QSpinBox *pathInfoTimeEdit{};
 
+    QString origPathInfoGensStyle;
+    QLabel *pathInfoGensLbl{};
+    QSpinBox *pathInfoGensEdit{};
+
+    QString origSlackTimeStyle;
+    QLabel *slackTimeLbl{};
+    QSpinBox *slackTimeEdit{};
+
     ExecutableValidator *exePathValidator{};
 };
 
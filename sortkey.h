@@ -0,0 +1,32 @@
+#ifndef SORTKEY_H
+#define SORTKEY_H
+
+#include <type_traits>
+#include <variant>
+
+#include <QString>
+#include <QVariant>
+
+/// @brief Typed key that a table cell sorts by.
+/// @note Cells sort by native numbers where they have them, so that
+///   ordering rows is a tight integer comparison instead of a conversion
+///   through <code>QVariant</code>. Cells without a value sort before all
+///   others & numbers sort before strings, as ordered by
+///   <code>std::variant</code>.
+using SortKey = std::variant<std::monostate, qint64, QString>;
+
+/// @brief Gets the given key as a <code>QVariant</code> of its value.
+inline auto toVariant(const SortKey& key) -> QVariant
+{
+    return std::visit([](const auto& value){
+        using T = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<T, std::monostate>) {
+            return QVariant{};
+        }
+        else {
+            return QVariant::fromValue(value);
+        }
+    }, key);
+}
+
+#endif // SORTKEY_H
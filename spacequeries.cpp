@@ -0,0 +1,85 @@
+#include <algorithm> // for std::max
+
+#include <QThreadPool>
+
+#include "spacequeries.h"
+#include "spacereader.h"
+
+SpaceQueries::SpaceQueries(QObject *parent):
+    QObject{parent},
+    threadPool{new QThreadPool{this}}
+{
+    this->threadPool->setMaxThreadCount(defaultMaxThreads);
+}
+
+SpaceQueries::~SpaceQueries() = default;
+
+auto SpaceQueries::timeToLive() const noexcept
+    -> std::chrono::milliseconds
+{
+    return this->ttl;
+}
+
+void SpaceQueries::setTimeToLive(std::chrono::milliseconds value)
+{
+    this->ttl = value;
+}
+
+auto SpaceQueries::find(const QString& path) const
+    -> std::optional<Result>
+{
+    const auto it = this->results.constFind(path);
+    if (it == this->results.constEnd()) {
+        return {};
+    }
+    return *it;
+}
+
+auto SpaceQueries::latency(const QString& path) const
+    -> std::optional<Latency>
+{
+    const auto it = this->latencies.constFind(path);
+    if (it == this->latencies.constEnd()) {
+        return {};
+    }
+    return *it;
+}
+
+auto SpaceQueries::query(const QString& path) -> bool
+{
+    if (this->inFlight.contains(path)) {
+        return false;
+    }
+    const auto it = this->results.constFind(path);
+    if ((it != this->results.constEnd()) &&
+        ((std::chrono::steady_clock::now() - it->time) < this->ttl)) {
+        return false;
+    }
+    this->inFlight.insert(path);
+    const auto reader = new SpaceReader{path.toStdString()};
+    reader->setAutoDelete(true);
+    connect(reader, &SpaceReader::ended,
+            this, &SpaceQueries::handleEnded);
+    this->threadPool->start(reader);
+    return true;
+}
+
+void SpaceQueries::handleEnded(const std::filesystem::path& path,
+                               const std::filesystem::space_info& info,
+                               std::error_code ec,
+                               std::chrono::microseconds latency)
+{
+    const auto key = QString::fromStdString(path.string());
+    this->inFlight.remove(key);
+    this->results.insert(key, Result{
+        .info = info,
+        .error = ec,
+        .time = std::chrono::steady_clock::now(),
+    });
+    auto& recorded = this->latencies[key];
+    recorded.last = latency;
+    recorded.max = std::max(recorded.max, latency);
+    recorded.total += latency;
+    ++recorded.count;
+    emit gotSpace(key, info, ec);
+}
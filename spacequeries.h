@@ -0,0 +1,85 @@
+#ifndef SPACEQUERIES_H
+#define SPACEQUERIES_H
+
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <system_error>
+
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QString>
+
+class QThreadPool;
+
+/// @brief Asynchronous & cached queries of file system space info.
+/// @note Queries are run on a thread pool of this object's own so a
+///   slow file system never blocks the thread this lives in. Results
+///   are cached for a time-to-live, within which querying the same
+///   path again starts nothing, & a query of a path that's already in
+///   flight is coalesced with it. The latency of the queries of each
+///   path is recorded.
+class SpaceQueries : public QObject
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    static constexpr auto defaultTimeToLive = std::chrono::seconds{30};
+    static constexpr auto defaultMaxThreads = 2;
+
+    struct Result {
+        std::filesystem::space_info info{};
+        std::error_code error;
+        std::chrono::steady_clock::time_point time;
+    };
+
+    struct Latency {
+        std::chrono::microseconds last{};
+        std::chrono::microseconds max{};
+        std::chrono::microseconds total{};
+        int count{};
+    };
+
+    explicit SpaceQueries(QObject *parent = nullptr);
+    ~SpaceQueries() override;
+
+    [[nodiscard]] auto timeToLive() const noexcept
+        -> std::chrono::milliseconds;
+    void setTimeToLive(std::chrono::milliseconds value);
+
+    /// @brief Finds the last result for the given path, however old.
+    [[nodiscard]] auto find(const QString& path) const
+        -> std::optional<Result>;
+
+    /// @brief Finds the recorded latency of queries of the given path.
+    [[nodiscard]] auto latency(const QString& path) const
+        -> std::optional<Latency>;
+
+    /// @brief Queries the space info of the given path.
+    /// @note Nothing is started if a result for the path is younger
+    ///   than the time-to-live, or if a query of it is in flight.
+    /// @return Whether a query was started.
+    auto query(const QString& path) -> bool;
+
+signals:
+    void gotSpace(const QString& path,
+                  const std::filesystem::space_info& info,
+                  std::error_code ec);
+
+private:
+    void handleEnded(const std::filesystem::path& path,
+                     const std::filesystem::space_info& info,
+                     std::error_code ec,
+                     std::chrono::microseconds latency);
+
+    QThreadPool *threadPool{};
+    std::chrono::milliseconds ttl{defaultTimeToLive};
+    QHash<QString, Result> results;
+    QHash<QString, Latency> latencies;
+    QSet<QString> inFlight;
+};
+
+#endif // SPACEQUERIES_H
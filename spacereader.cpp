@@ -0,0 +1,26 @@
+#include "spacereader.h"
+
+SpaceReader::SpaceReader(std::filesystem::path path,
+                         QObject *parent):
+    QObject{parent},
+    filesystemPath{std::move(path)}
+{
+}
+
+SpaceReader::~SpaceReader() = default;
+
+auto SpaceReader::path() const -> std::filesystem::path
+{
+    return this->filesystemPath;
+}
+
+void SpaceReader::run()
+{
+    using namespace std::chrono;
+    auto ec = std::error_code{};
+    const auto start = steady_clock::now();
+    const auto info = std::filesystem::space(this->filesystemPath, ec);
+    const auto latency = duration_cast<microseconds>(
+        steady_clock::now() - start);
+    emit ended(this->filesystemPath, info, ec, latency);
+}
@@ -0,0 +1,41 @@
+#ifndef SPACEREADER_H
+#define SPACEREADER_H
+
+#include <chrono>
+#include <filesystem>
+#include <system_error>
+
+#include <QObject>
+#include <QRunnable>
+
+/// @brief Reader of the space info of a file system.
+/// @note This is meant to be run from a thread pool, since the
+///   <code>statvfs</code> call behind it can block for seconds on a
+///   sleeping external disk or an unresponsive network destination.
+class SpaceReader: public QObject, public QRunnable
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    SpaceReader(std::filesystem::path path,
+                QObject *parent = nullptr);
+    ~SpaceReader() override;
+
+    auto path() const -> std::filesystem::path;
+
+signals:
+    /// @brief Signals the result of the read & how long it took.
+    void ended(const std::filesystem::path &path,
+               const std::filesystem::space_info &info,
+               std::error_code ec,
+               std::chrono::microseconds latency);
+
+private:
+    void run() override;
+
+    std::filesystem::path filesystemPath;
+};
+
+#endif // SPACEREADER_H
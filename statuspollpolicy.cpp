@@ -0,0 +1,88 @@
+#include <algorithm> // for std::max, std::min
+
+#include "statuspollpolicy.h"
+
+namespace {
+
+/// @brief Most doublings of the idle interval that are computed.
+/// @note Far more than needed to reach the maximum interval, but few
+///   enough not to overflow.
+constexpr auto maxDoublings = 16;
+
+}
+
+StatusPollPolicy::StatusPollPolicy(std::chrono::milliseconds idleInterval):
+    idle{idleInterval},
+    current{idleInterval}
+{
+}
+
+auto StatusPollPolicy::interval() const noexcept -> std::chrono::milliseconds
+{
+    return this->current;
+}
+
+auto StatusPollPolicy::idleInterval() const noexcept
+    -> std::chrono::milliseconds
+{
+    return this->idle;
+}
+
+void StatusPollPolicy::setIdleInterval(std::chrono::milliseconds value)
+{
+    this->idle = value;
+    this->idlePolls = 0;
+    this->current = (this->fastPolls > 0)? this->fastInterval(): value;
+}
+
+auto StatusPollPolicy::polled(bool active) -> std::chrono::milliseconds
+{
+    this->failures = 0;
+    if (active) {
+        this->idlePolls = 0;
+        this->fastPolls = 0;
+        this->current = this->fastInterval();
+    }
+    else if (this->fastPolls > 0) {
+        --(this->fastPolls);
+        this->current = this->fastInterval();
+    }
+    else {
+        this->current = this->backedOff(this->idlePolls);
+        this->idlePolls = std::min(this->idlePolls + 1, maxDoublings);
+    }
+    return this->current;
+}
+
+auto StatusPollPolicy::failed() -> std::chrono::milliseconds
+{
+    this->failures = std::min(this->failures + 1, maxDoublings);
+    this->current = this->backedOff(std::max(this->failures, this->idlePolls));
+    return this->current;
+}
+
+auto StatusPollPolicy::requested() -> std::chrono::milliseconds
+{
+    this->idlePolls = 0;
+    this->failures = 0;
+    this->fastPolls = requestedFastPolls;
+    this->current = this->fastInterval();
+    return this->current;
+}
+
+auto StatusPollPolicy::fastInterval() const noexcept
+    -> std::chrono::milliseconds
+{
+    return std::min(defaultActiveInterval, this->idle);
+}
+
+auto StatusPollPolicy::backedOff(int times) const noexcept
+    -> std::chrono::milliseconds
+{
+    const auto limit = std::max(defaultMaxInterval, this->idle);
+    auto result = this->idle;
+    for (auto i = 0; (i < times) && (result < limit); ++i) {
+        result *= 2;
+    }
+    return std::min(result, limit);
+}
@@ -0,0 +1,57 @@
+#ifndef STATUSPOLLPOLICY_H
+#define STATUSPOLLPOLICY_H
+
+#include <chrono>
+
+/// @brief Policy of how often to poll the Time Machine status.
+/// @note Polls are fast while a backup phase is active, so its progress
+///   is shown closely, & for a few polls after a backup's been asked
+///   for, until its phase shows up. Otherwise polls back off from the
+///   idle interval, doubling per idle poll, & likewise per consecutive
+///   failed poll, up to a maximum interval.
+class StatusPollPolicy
+{
+public:
+    static constexpr auto defaultActiveInterval = std::chrono::milliseconds{1000};
+    static constexpr auto defaultMaxInterval = std::chrono::milliseconds{60000};
+
+    /// @brief Number of polls that stay fast after a backup is asked for,
+    ///   while no phase is reported yet.
+    static constexpr auto requestedFastPolls = 5;
+
+    explicit StatusPollPolicy(std::chrono::milliseconds idleInterval);
+
+    /// @brief Interval until the next poll.
+    [[nodiscard]] auto interval() const noexcept -> std::chrono::milliseconds;
+
+    [[nodiscard]] auto idleInterval() const noexcept -> std::chrono::milliseconds;
+
+    /// @brief Sets the interval that idle polls back off from.
+    /// @note The active interval is never more than this.
+    void setIdleInterval(std::chrono::milliseconds value);
+
+    /// @brief Records a poll that got a status.
+    /// @param active Whether the status has a backup phase.
+    /// @return Interval until the next poll.
+    auto polled(bool active) -> std::chrono::milliseconds;
+
+    /// @brief Records a poll that failed.
+    /// @return Interval until the next poll.
+    auto failed() -> std::chrono::milliseconds;
+
+    /// @brief Records that a backup was asked to start or stop.
+    /// @return Interval until the next poll.
+    auto requested() -> std::chrono::milliseconds;
+
+private:
+    [[nodiscard]] auto fastInterval() const noexcept -> std::chrono::milliseconds;
+    [[nodiscard]] auto backedOff(int times) const noexcept -> std::chrono::milliseconds;
+
+    std::chrono::milliseconds idle;
+    std::chrono::milliseconds current;
+    int idlePolls{};
+    int failures{};
+    int fastPolls{};
+};
+
+#endif // STATUSPOLLPOLICY_H
@@ -0,0 +1,33 @@
+#include "stringinterner.h"
+
+auto StringInterner::intern(const QString& string) -> NameId
+{
+    const auto it = this->ids.constFind(string);
+    if (it != this->ids.constEnd()) {
+        return *it;
+    }
+    const auto id = static_cast<NameId>(this->strings.size());
+    this->strings.push_back(string);
+    this->ids.insert(string, id);
+    return id;
+}
+
+auto StringInterner::find(const QString& string) const
+    -> std::optional<NameId>
+{
+    const auto it = this->ids.constFind(string);
+    if (it != this->ids.constEnd()) {
+        return *it;
+    }
+    return {};
+}
+
+auto StringInterner::string(NameId id) const -> const QString&
+{
+    return this->strings[id];
+}
+
+auto StringInterner::size() const noexcept -> std::size_t
+{
+    return this->strings.size();
+}
@@ -0,0 +1,38 @@
+#ifndef STRINGINTERNER_H
+#define STRINGINTERNER_H
+
+#include <cstddef> // for std::size_t
+#include <optional>
+#include <vector>
+
+#include <QHash>
+#include <QString>
+
+#include "idset.h"
+
+/// @brief Interner of strings to small, densely assigned, identifiers.
+/// @note Identifiers are assigned in order starting from zero and are
+///   never reused, so they're suitable as bit positions in an
+///   <code>IdSet</code>.
+class StringInterner
+{
+public:
+    /// @brief Gets the identifier for the given string, adding it if new.
+    auto intern(const QString& string) -> NameId;
+
+    /// @brief Finds the identifier for the given string.
+    [[nodiscard]] auto find(const QString& string) const
+        -> std::optional<NameId>;
+
+    /// @brief Gets the string for the given identifier.
+    /// @note Behavior is undefined for an identifier not from this.
+    [[nodiscard]] auto string(NameId id) const -> const QString&;
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t;
+
+private:
+    std::vector<QString> strings;
+    QHash<QString, NameId> ids;
+};
+
+#endif // STRINGINTERNER_H
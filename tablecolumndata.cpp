@@ -0,0 +1,23 @@
+#include <QCoreApplication>
+
+#include "tablecolumndata.h"
+
+auto headerData(const std::map<int, TableColumnData> &columns,
+                int section, int role) -> QVariant
+{
+    const auto it = columns.find(section);
+    if (it == columns.end()) {
+        return {};
+    }
+    switch (role) {
+    case Qt::DisplayRole:
+        return QCoreApplication::translate("MainWindow", it->second.text);
+    case Qt::ToolTipRole:
+        return QCoreApplication::translate("MainWindow", it->second.toolTip);
+    case Qt::TextAlignmentRole:
+        return QVariant::fromValue(it->second.texAlignment);
+    default:
+        break;
+    }
+    return {};
+}
@@ -0,0 +1,22 @@
+#ifndef TABLECOLUMNDATA_H
+#define TABLECOLUMNDATA_H
+
+#include <map>
+
+#include <QVariant>
+
+/// @brief Static description of a table column's header.
+struct TableColumnData
+{
+    const char *text{};
+    const char *toolTip{};
+    Qt::Alignment texAlignment{Qt::AlignCenter};
+};
+
+/// @brief Gets the horizontal header data for the given section & role.
+/// @note This is meant for implementing
+///   <code>QAbstractItemModel::headerData</code>.
+auto headerData(const std::map<int, TableColumnData> &columns,
+                int section, int role) -> QVariant;
+
+#endif // TABLECOLUMNDATA_H
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include "backupcatalog.h"
+
+namespace {
+
+auto idSet(std::initializer_list<NameId> ids) -> IdSet
+{
+    auto result = IdSet{};
+    for (const auto id: ids) {
+        result.set(id);
+    }
+    return result;
+}
+
+}
+
+TEST(BackupCatalog, KeepsBackupsOfSameNameOnOtherDestinations)
+{
+    auto catalog = BackupCatalog{};
+    auto& names = catalog.names();
+    const auto destA = names.destinations.intern("A");
+    const auto destB = names.destinations.intern("B");
+    const auto machine = names.machines.intern("Mac");
+    const auto backup = names.backups.intern("2024-01-01-000000");
+    const auto volume = names.volumes.intern("Macintosh HD");
+
+    (void) catalog.updateMachine(machine, "UUID", {}, {}, destA);
+    (void) catalog.updateMachine(machine, "UUID", {}, {}, destB);
+    for (const auto destination: {destA, destB}) {
+        (void) catalog.setMachineBackups(destination, machine,
+                                         idSet({backup}));
+        catalog.stageBackup({.key = {destination, machine, backup}});
+        catalog.stageVolume({}, volume, "VOLUME-UUID", {}, {},
+                            machine, destination, backup);
+    }
+    catalog.applyPending();
+    ASSERT_EQ(catalog.backups().size(), 2u);
+    ASSERT_EQ(catalog.volumes().size(), 1u);
+
+    const auto removed = catalog.setMachineBackups(destA, machine, {});
+    EXPECT_TRUE(removed.test(backup));
+    EXPECT_EQ(catalog.backups().size(), 1u);
+    EXPECT_TRUE(catalog.machines()[0].backups.test(backup));
+    EXPECT_TRUE(catalog.volumes()[0].backups.test(backup));
+
+    (void) catalog.setMachineBackups(destB, machine, {});
+    EXPECT_TRUE(catalog.backups().empty());
+    EXPECT_FALSE(catalog.machines()[0].backups.test(backup));
+    EXPECT_FALSE(catalog.volumes()[0].backups.test(backup));
+}
+
+TEST(BackupCatalog, EvictsOldestSealedBackupsWithoutRestaging)
+{
+    auto catalog = BackupCatalog{};
+    auto& names = catalog.names();
+    const auto destination = names.destinations.intern("A");
+    const auto machine = names.machines.intern("Mac");
+    const auto volume = names.volumes.intern("Macintosh HD");
+    const auto older = names.backups.intern("2024-01-01-000000");
+    const auto newer = names.backups.intern("2024-01-02-000000");
+    const auto unsealed = names.backups.intern("2023-01-01-000000");
+
+    (void) catalog.updateMachine(machine, "UUID", {}, {}, destination);
+    const auto found = idSet({older, newer, unsealed});
+    (void) catalog.setMachineBackups(destination, machine, found);
+    for (const auto backup: {older, newer, unsealed}) {
+        catalog.stageBackup({
+            .key = {destination, machine, backup},
+            .path = names.backups.string(backup),
+            .sealed = (backup != unsealed),
+        });
+        catalog.stageBackupVolumes({destination, machine, backup},
+                                   idSet({volume}));
+    }
+    catalog.applyPending();
+    ASSERT_EQ(catalog.backups().size(), 3u);
+
+    const auto evicted = catalog.evictSealedBackups(2u);
+    ASSERT_EQ(evicted.size(), 1u);
+    EXPECT_EQ(evicted[0], QString{"2024-01-01-000000"});
+    EXPECT_EQ(catalog.backups().size(), 2u);
+    EXPECT_LT(catalog.findBackup({destination, machine, older}), 0);
+    EXPECT_TRUE(catalog.sealedBackups(destination, machine).test(older));
+    EXPECT_TRUE(catalog.machines()[0].backups.test(older));
+
+    // Only sealed backups are evicted.
+    EXPECT_EQ(catalog.evictSealedBackups(0u).size(), 1u);
+    EXPECT_EQ(catalog.backups().size(), 1u);
+
+    // Evicted backups that are deleted are gone from their machine.
+    (void) catalog.setMachineBackups(destination, machine,
+                                     idSet({unsealed}));
+    EXPECT_FALSE(catalog.sealedBackups(destination, machine).test(older));
+    EXPECT_FALSE(catalog.machines()[0].backups.test(older));
+}
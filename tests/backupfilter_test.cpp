@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include "backupfilter.h"
+
+namespace {
+
+auto idSet(std::initializer_list<NameId> ids) -> IdSet
+{
+    auto result = IdSet{};
+    for (const auto id: ids) {
+        result.set(id);
+    }
+    return result;
+}
+
+}
+
+TEST(BackupFilter, AcceptsByDefault)
+{
+    const auto filter = BackupFilter{};
+    EXPECT_TRUE(filter.accepts(0u, 0u, idSet({0u, 1u})));
+}
+
+TEST(BackupFilter, RejectsHiddenDestination)
+{
+    auto filter = BackupFilter{};
+    filter.hiddenDestinations.set(1u);
+    EXPECT_FALSE(filter.accepts(1u, 0u, idSet({0u})));
+    EXPECT_TRUE(filter.accepts(2u, 0u, idSet({0u})));
+}
+
+TEST(BackupFilter, RejectsHiddenMachine)
+{
+    auto filter = BackupFilter{};
+    filter.hiddenMachines.set(3u);
+    EXPECT_FALSE(filter.accepts(0u, 3u, idSet({0u})));
+    EXPECT_TRUE(filter.accepts(0u, 2u, idSet({0u})));
+}
+
+TEST(BackupFilter, RejectsOnlyHiddenVolumes)
+{
+    auto filter = BackupFilter{};
+    filter.hiddenVolumes.set(0u);
+    filter.hiddenVolumes.set(70u);
+    EXPECT_FALSE(filter.accepts(0u, 0u, idSet({0u, 70u})));
+    EXPECT_TRUE(filter.accepts(0u, 0u, idSet({0u, 71u})));
+}
+
+TEST(BackupFilter, AcceptsVolumesNotYetRead)
+{
+    auto filter = BackupFilter{};
+    filter.hiddenVolumes.set(0u);
+    EXPECT_TRUE(filter.accepts(0u, 0u, IdSet{}));
+    filter.hiddenMachines.set(0u);
+    EXPECT_FALSE(filter.accepts(0u, 0u, IdSet{}));
+}
@@ -0,0 +1,94 @@
+#include <sys/xattr.h> // for setxattr
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <QCoreApplication>
+#include <QDeadlineTimer>
+#include <QTemporaryDir>
+
+#include "attributerecord.h"
+#include "backupattributes.h"
+#include "backupcatalog.h"
+#include "catalogscanner.h"
+#include "jobscheduler.h"
+#include "plist_object.h"
+
+namespace {
+
+constexpr auto scanTimeout = std::chrono::seconds{10};
+
+void setAttribute(const std::filesystem::path& path,
+                  const char *name, const std::string& value)
+{
+    ASSERT_EQ(::setxattr(path.c_str(), name, value.data(), value.size(),
+                         0, 0), 0) << name << " on " << path;
+}
+
+auto makeDestination(const std::string& mountPoint)
+    -> plist_ptr<plist_dict>
+{
+    auto destination = plist_dict{};
+    destination["ID"] = plist_object{plist_string{"TEST-ID"}};
+    destination["Name"] = plist_object{plist_string{"Test"}};
+    destination["Kind"] = plist_object{plist_string{"Local"}};
+    destination["MountPoint"] = plist_object{plist_string{mountPoint}};
+    return std::make_shared<const plist_dict>(std::move(destination));
+}
+
+}
+
+TEST(CatalogScanner, CatalogsMachinesAndBackupsOfMountPoint)
+{
+    auto argc = 0;
+    QCoreApplication app{argc, nullptr};
+    qRegisterMetaType<std::filesystem::path>();
+    qRegisterMetaType<std::filesystem::file_status>();
+    qRegisterMetaType<std::error_code>();
+    qRegisterMetaType<AttributeRecord>();
+
+    const QTemporaryDir tempDir;
+    ASSERT_TRUE(tempDir.isValid());
+    const auto mountPoint = std::filesystem::path{tempDir.path().toStdString()};
+    const auto storageDir = mountPoint / "Backups.backupdb";
+    const auto machineDir = storageDir / "Mac";
+    const auto backupDir = machineDir / "2024-01-01-000000";
+    std::filesystem::create_directories(backupDir);
+    setAttribute(storageDir, timeMachineMetaAttr, "SnapshotStorage");
+    setAttribute(machineDir, machineCompNameAttr, "Mac");
+    setAttribute(machineDir, machineUuidAttr, "MACHINE-UUID");
+    setAttribute(backupDir, snapshotTypeAttr, "1");
+    setAttribute(backupDir, snapshotStateAttr, "Completed");
+
+    auto catalog = BackupCatalog{};
+    auto scheduler = JobScheduler{};
+    auto scanner = CatalogScanner{&catalog, &scheduler};
+    scanner.setScanInterval(std::chrono::milliseconds{10});
+    scanner.setDestinations({makeDestination(mountPoint.string())});
+
+    const auto deadline = QDeadlineTimer{scanTimeout};
+    while ((catalog.machines().empty() || catalog.backups().empty()) &&
+           !deadline.hasExpired()) {
+        QCoreApplication::processEvents(QEventLoop::AllEvents, 50);
+        if (catalog.hasPending()) {
+            catalog.applyPending();
+        }
+    }
+
+    ASSERT_EQ(catalog.machines().size(), 1u);
+    EXPECT_EQ(catalog.names().machines.string(catalog.machines()[0].name),
+              QString{"Mac"});
+    EXPECT_EQ(catalog.machines()[0].uuid, QString{"MACHINE-UUID"});
+    ASSERT_EQ(catalog.backups().size(), 1u);
+    const auto& backup = catalog.backups()[0];
+    EXPECT_EQ(catalog.names().backups.string(backup.key.name),
+              QString{"2024-01-01-000000"});
+    EXPECT_EQ(catalog.names().destinations.string(backup.key.destination),
+              QString{"Test"});
+}
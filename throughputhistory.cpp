@@ -0,0 +1,144 @@
+#include <algorithm> // for std::max, std::min
+#include <cmath> // for std::exp, std::lround
+
+#include "throughputhistory.h"
+
+namespace {
+
+/// @brief Block elements from lowest to highest, for sparklines.
+constexpr auto sparkBlocks = std::array<char16_t, 8>{
+    u'▁', u'▂', u'▃', u'▄',
+    u'▅', u'▆', u'▇', u'█',
+};
+
+auto seconds(ThroughputHistory::Clock::duration value) -> double
+{
+    return std::chrono::duration<double>(value).count();
+}
+
+}
+
+void ThroughputHistory::record(const Sample& sample) noexcept
+{
+    if (this->count == 0u) {
+        this->samples[this->first] = sample;
+        this->count = 1u;
+        return;
+    }
+    const auto& latest = (*this)[this->count - 1u];
+    if ((sample.bytes < latest.bytes) || (sample.files < latest.files)) {
+        this->clear();
+        this->record(sample);
+        return;
+    }
+    const auto elapsed = seconds(sample.time - latest.time);
+    if (elapsed <= 0.0) {
+        this->samples[(this->first + this->count - 1u) % capacity] = sample;
+        return;
+    }
+    const auto current = Rate{
+        .bytesPerSecond = double(sample.bytes - latest.bytes) / elapsed,
+        .filesPerSecond = double(sample.files - latest.files) / elapsed,
+    };
+    if (this->count == 1u) {
+        this->smoothed = current;
+    }
+    else {
+        const auto alpha =
+            1.0 - std::exp(-elapsed / seconds(smoothingTime));
+        this->smoothed.bytesPerSecond +=
+            alpha * (current.bytesPerSecond - this->smoothed.bytesPerSecond);
+        this->smoothed.filesPerSecond +=
+            alpha * (current.filesPerSecond - this->smoothed.filesPerSecond);
+    }
+    if (this->count < capacity) {
+        this->samples[(this->first + this->count) % capacity] = sample;
+        ++(this->count);
+        return;
+    }
+    this->samples[this->first] = sample;
+    this->first = (this->first + 1u) % capacity;
+}
+
+void ThroughputHistory::clear() noexcept
+{
+    this->first = 0u;
+    this->count = 0u;
+    this->smoothed = Rate{};
+}
+
+auto ThroughputHistory::size() const noexcept -> std::size_t
+{
+    return this->count;
+}
+
+auto ThroughputHistory::empty() const noexcept -> bool
+{
+    return this->count == 0u;
+}
+
+auto ThroughputHistory::operator[](std::size_t index) const noexcept
+    -> const Sample&
+{
+    return this->samples[(this->first + index) % capacity];
+}
+
+auto ThroughputHistory::rate() const noexcept -> std::optional<Rate>
+{
+    if (this->count < 2u) {
+        return {};
+    }
+    return this->smoothed;
+}
+
+auto ThroughputHistory::remaining() const noexcept
+    -> std::optional<std::chrono::seconds>
+{
+    const auto r = this->rate();
+    if (!r) {
+        return {};
+    }
+    const auto& latest = (*this)[this->count - 1u];
+    auto left = 0.0;
+    if ((latest.totalBytes > 0) && (r->bytesPerSecond > 0.0)) {
+        left = double(std::max(latest.totalBytes - latest.bytes,
+                               std::int64_t{})) / r->bytesPerSecond;
+    }
+    else if ((latest.totalFiles > 0) && (r->filesPerSecond > 0.0)) {
+        left = double(std::max(latest.totalFiles - latest.files,
+                               std::int64_t{})) / r->filesPerSecond;
+    }
+    else {
+        return {};
+    }
+    return std::chrono::seconds{std::lround(left)};
+}
+
+auto ThroughputHistory::sparkline(std::size_t width) const -> QString
+{
+    if (this->count < 2u) {
+        return {};
+    }
+    const auto shown = std::min(width, this->count - 1u);
+    auto rates = std::array<double, capacity>{};
+    auto highest = 0.0;
+    for (auto i = 0u; i < shown; ++i) {
+        const auto& later = (*this)[this->count - shown + i];
+        const auto& earlier = (*this)[this->count - shown + i - 1u];
+        const auto elapsed = seconds(later.time - earlier.time);
+        rates[i] = (elapsed > 0.0)
+            ? double(later.bytes - earlier.bytes) / elapsed
+            : 0.0;
+        highest = std::max(highest, rates[i]);
+    }
+    auto result = QString{};
+    result.reserve(qsizetype(shown));
+    const auto top = double(sparkBlocks.size() - 1u);
+    for (auto i = 0u; i < shown; ++i) {
+        const auto level = (highest > 0.0)
+            ? std::lround((rates[i] / highest) * top)
+            : 0L;
+        result.append(QChar(sparkBlocks[std::size_t(level)]));
+    }
+    return result;
+}
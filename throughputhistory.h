@@ -0,0 +1,79 @@
+#ifndef THROUGHPUTHISTORY_H
+#define THROUGHPUTHISTORY_H
+
+#include <array>
+#include <chrono>
+#include <cstddef> // for std::size_t
+#include <cstdint>
+#include <optional>
+
+#include <QString>
+
+/// @brief Fixed size history of the progress samples of a backup, &
+///   the throughput & time remaining estimated from them.
+/// @note Samples are held in a ring buffer, so recording one never
+///   allocates & the oldest are overwritten once it's full. The
+///   smoothed rates are exponentially weighted moving averages of the
+///   rates between consecutive samples, weighted by the time between
+///   them, so they're independent of how often samples are recorded.
+///   A sample having fewer bytes or files than the latest is taken to
+///   be from a new backup & starts the history over.
+class ThroughputHistory
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Maximum number of samples held.
+    static constexpr auto capacity = std::size_t{128};
+
+    /// @brief Time over which the weight of a rate falls to about a third.
+    static constexpr auto smoothingTime = std::chrono::seconds{20};
+
+    struct Sample {
+        std::int64_t bytes{};
+        std::int64_t totalBytes{};
+        std::int64_t files{};
+        std::int64_t totalFiles{};
+        Clock::time_point time;
+    };
+
+    struct Rate {
+        double bytesPerSecond{};
+        double filesPerSecond{};
+    };
+
+    /// @brief Records the given sample.
+    /// @note A sample no later than the latest replaces it.
+    void record(const Sample& sample) noexcept;
+
+    void clear() noexcept;
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t;
+    [[nodiscard]] auto empty() const noexcept -> bool;
+
+    /// @brief Gets the sample at the given index, from the oldest held.
+    [[nodiscard]] auto operator[](std::size_t index) const noexcept
+        -> const Sample&;
+
+    /// @brief Smoothed throughput, if at least two samples are held.
+    [[nodiscard]] auto rate() const noexcept -> std::optional<Rate>;
+
+    /// @brief Time remaining estimated from the smoothed throughput.
+    /// @note Estimated from bytes, or from files when the total bytes
+    ///   isn't known.
+    [[nodiscard]] auto remaining() const noexcept
+        -> std::optional<std::chrono::seconds>;
+
+    /// @brief Sparkline of the bytes per second between the latest
+    ///   samples, using block elements scaled to the highest rate shown.
+    /// @param width Maximum number of rates shown.
+    [[nodiscard]] auto sparkline(std::size_t width) const -> QString;
+
+private:
+    std::array<Sample, capacity> samples{};
+    std::size_t first{};
+    std::size_t count{};
+    Rate smoothed{};
+};
+
+#endif // THROUGHPUTHISTORY_H
@@ -0,0 +1,39 @@
+#include <QApplication>
+#include <QPainter>
+#include <QStyle>
+#include <QStyleOptionProgressBar>
+
+#include "usagebardelegate.h"
+
+namespace {
+
+constexpr auto percentMin = 0;
+constexpr auto percentMax = 100;
+
+}
+
+void UsageBarDelegate::paint(QPainter *painter,
+                             const QStyleOptionViewItem &option,
+                             const QModelIndex &index) const
+{
+    const auto percent = index.data(Qt::UserRole);
+    if (!percent.isValid()) {
+        QStyledItemDelegate::paint(painter, option, index);
+        return;
+    }
+    auto bar = QStyleOptionProgressBar{};
+    bar.rect = option.rect;
+    bar.palette = option.palette;
+    bar.fontMetrics = option.fontMetrics;
+    bar.direction = option.direction;
+    bar.state = option.state|QStyle::State_Horizontal;
+    bar.minimum = percentMin;
+    bar.maximum = percentMax;
+    bar.progress = percent.toInt();
+    bar.text = index.data(Qt::DisplayRole).toString();
+    bar.textAlignment = Qt::AlignCenter;
+    bar.textVisible = true;
+    const auto widget = option.widget;
+    const auto style = widget? widget->style(): QApplication::style();
+    style->drawControl(QStyle::CE_ProgressBar, &bar, painter, widget);
+}
@@ -0,0 +1,25 @@
+#ifndef USAGEBARDELEGATE_H
+#define USAGEBARDELEGATE_H
+
+#include <QStyledItemDelegate>
+
+/// @brief Delegate painting a usage percentage as a progress bar.
+/// @note The percentage is taken from the <code>Qt::UserRole</code> of
+///   the index & the bar's text from its display role. Indices without
+///   a percentage are painted as usual. Nothing is allocated per item,
+///   unlike a progress bar widget in each cell.
+class UsageBarDelegate : public QStyledItemDelegate
+{
+    // NOLINTBEGIN
+    Q_OBJECT
+    // NOLINTEND
+
+public:
+    using QStyledItemDelegate::QStyledItemDelegate;
+
+    void paint(QPainter *painter,
+               const QStyleOptionViewItem &option,
+               const QModelIndex &index) const override;
+};
+
+#endif // USAGEBARDELEGATE_H
@@ -0,0 +1,217 @@
+#include <QFontDatabase>
+
+#include "catalognames.h"
+#include "idsetstrings.h"
+#include "tablecolumndata.h"
+#include "volumesmodel.h"
+
+namespace {
+
+constexpr auto alignRight = Qt::AlignRight|Qt::AlignVCenter;
+
+}
+
+VolumesModel::VolumesModel(const BackupCatalog *catalog, QObject *parent):
+    CatalogTableModel{catalog, BackupCatalog::Table::Volumes,
+                      VolumesColumn::count, parent},
+    fixedFont{QFontDatabase::systemFont(QFontDatabase::FixedFont)}
+{
+}
+
+auto VolumesModel::data(const QModelIndex &index, int role) const
+    -> QVariant
+{
+    if (!index.isValid()) {
+        return {};
+    }
+    if (role == SortRole) {
+        return toVariant(this->sortKey(index.row(), index.column()));
+    }
+    const auto& names = this->catalog().names();
+    const auto& row = this->catalog().volumes()[index.row()];
+    switch (index.column()) {
+    case VolumesColumn::Name:
+        switch (role) {
+        case Qt::DisplayRole:
+            return names.volumes.string(row.name);
+        case Qt::UserRole:
+            return row.path;
+        case Qt::CheckStateRole:
+            return static_cast<int>(this->checkStates[index.row()]);
+        }
+        break;
+    case VolumesColumn::Uuid:
+        switch (role) {
+        case Qt::DisplayRole:
+            return row.uuid;
+        case Qt::FontRole:
+            return this->fixedFont;
+        }
+        break;
+    case VolumesColumn::Type:
+        if (role == Qt::DisplayRole) {
+            return row.type;
+        }
+        break;
+    case VolumesColumn::MaxUsed:
+        switch (role) {
+        case Qt::DisplayRole:
+            return QVariant::fromValue(row.maxUsed);
+        case Qt::FontRole:
+            return this->fixedFont;
+        case Qt::TextAlignmentRole:
+            return QVariant::fromValue(alignRight);
+        }
+        return {};
+    case VolumesColumn::Machines:
+    case VolumesColumn::Destinations:
+    case VolumesColumn::Backups:
+    {
+        switch (role) {
+        case Qt::DisplayRole:
+            return qsizetype(
+                ((index.column() == VolumesColumn::Machines)
+                     ? row.machines
+                     : (index.column() == VolumesColumn::Destinations)
+                           ? row.destinations
+                           : row.backups).count());
+        case Qt::ToolTipRole:
+            switch (index.column()) {
+            case VolumesColumn::Machines:
+                return toStringList(row.machines, names.machines,
+                                    maxToolTipStringList).join(", ");
+            case VolumesColumn::Destinations:
+                return toStringList(row.destinations, names.destinations,
+                                    maxToolTipStringList).join(", ");
+            }
+            return firstToLastToolTip(row.backups, names.backups);
+        case Qt::FontRole:
+            return this->fixedFont;
+        case Qt::TextAlignmentRole:
+            return QVariant::fromValue(alignRight);
+        }
+        return {};
+    }
+    }
+    if (role == Qt::TextAlignmentRole) {
+        return QVariant::fromValue(Qt::Alignment{Qt::AlignCenter});
+    }
+    return {};
+}
+
+auto VolumesModel::sortKey(int row, int column) const -> SortKey
+{
+    const auto& names = this->catalog().names();
+    const auto& entry = this->catalog().volumes()[row];
+    switch (column) {
+    case VolumesColumn::Name:
+        return names.volumes.string(entry.name);
+    case VolumesColumn::Uuid:
+        return entry.uuid;
+    case VolumesColumn::Type:
+        return entry.type;
+    case VolumesColumn::MaxUsed:
+        return entry.maxUsed;
+    case VolumesColumn::Machines:
+        return qint64(entry.machines.count());
+    case VolumesColumn::Destinations:
+        return qint64(entry.destinations.count());
+    case VolumesColumn::Backups:
+        return qint64(entry.backups.count());
+    }
+    return {};
+}
+
+auto VolumesModel::headerData(int section,
+                              Qt::Orientation orientation,
+                              int role) const -> QVariant
+{
+    static const auto columns = std::map<int, TableColumnData>{
+        {VolumesColumn::Name, {"Name", "Volume name."}},
+        {VolumesColumn::Uuid, {"UUID", "Universal unique identifier of the volume."}},
+        {VolumesColumn::Type, {"Type", "File system type of the volume."}},
+        {VolumesColumn::MaxUsed,
+         {"Max Used",
+          "Maximum byte size of the volume in all backups.",
+          Qt::AlignTrailing|Qt::AlignVCenter}},
+        {VolumesColumn::Machines,
+         {
+          "Machines",
+          "Number of machines for which this volume is associated with."
+          "This is usually 1, unless the storage has been shared with other machines.",
+          Qt::AlignTrailing|Qt::AlignVCenter}},
+        {VolumesColumn::Destinations,
+         {"Destinations",
+          "Number of destinations storing backups of the volume.",
+          Qt::AlignTrailing|Qt::AlignVCenter}},
+        {VolumesColumn::Backups,
+         {"Backups",
+          "Number of backups found for the volume.",
+          Qt::AlignTrailing|Qt::AlignVCenter}},
+    };
+    if (orientation != Qt::Horizontal) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+    return ::headerData(columns, section, role);
+}
+
+auto VolumesModel::flags(const QModelIndex &index) const
+    -> Qt::ItemFlags
+{
+    if (!index.isValid()) {
+        return Qt::NoItemFlags;
+    }
+    if (index.column() == VolumesColumn::Name) {
+        return Qt::ItemIsEnabled|Qt::ItemIsUserCheckable;
+    }
+    return Qt::ItemIsEnabled;
+}
+
+auto VolumesModel::setData(const QModelIndex &index,
+                           const QVariant &value,
+                           int role) -> bool
+{
+    if (!index.isValid() || (index.column() != VolumesColumn::Name) ||
+        (role != Qt::CheckStateRole)) {
+        return false;
+    }
+    auto& state = this->checkStates[index.row()];
+    const auto checked = static_cast<Qt::CheckState>(value.toInt());
+    if (state == checked) {
+        return true;
+    }
+    const auto wasChecked = (state != Qt::Unchecked);
+    state = checked;
+    emit dataChanged(index, index, {Qt::CheckStateRole});
+    if (wasChecked != (checked != Qt::Unchecked)) {
+        const auto name = this->catalog().volumes()[index.row()].name;
+        auto& count = this->checkedCounts[name];
+        count += wasChecked? -1: +1;
+        if (count == (wasChecked? 0: 1)) {
+            emit checkedChanged(name, !wasChecked);
+        }
+    }
+    return true;
+}
+
+void VolumesModel::entriesInserted(int first, int last)
+{
+    this->checkStates.insert(this->checkStates.begin() + first,
+                             std::size_t(last - first + 1), Qt::Checked);
+    const auto& volumes = this->catalog().volumes();
+    for (auto i = first; i <= last; ++i) {
+        ++this->checkedCounts[volumes[i].name];
+    }
+}
+
+void VolumesModel::entriesAboutToBeRemoved(int first, int last)
+{
+    const auto& volumes = this->catalog().volumes();
+    for (auto i = first; i <= last; ++i) {
+        if (this->checkStates[i] != Qt::Unchecked) {
+            --this->checkedCounts[volumes[i].name];
+        }
+    }
+    this->checkStates.erase(this->checkStates.begin() + first,
+                            this->checkStates.begin() + last + 1);
+}